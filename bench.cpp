@@ -0,0 +1,1741 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+//
+// bench - throughput of libsunwait operations
+//
+// Usage: bench [name ...]
+// Without names all benchmarks are run. Each prints the time per operation.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "libsunwait.hpp"
+#include "coordinate.hpp"
+#include "formatter.hpp"
+#include "waittoken.hpp"
+#include "simulation.hpp"
+#include "ephemeris.hpp"
+#include "rules.hpp"
+#include "sweep.hpp"
+#include "track.hpp"
+#include "contour.hpp"
+#include "daylight.hpp"
+#include "irradiance.hpp"
+#include "facade.hpp"
+#include "horizon.hpp"
+#include "fleet.hpp"
+#include "reference.hpp"
+#include "suncache.hpp"
+#include "sun.hpp"
+#if defined __linux__ || defined __APPLE__
+#include "sunstate.hpp"
+#endif
+
+typedef std::chrono::steady_clock Clock;
+
+static bool benchFailed = false; // Set by the benchmarks which check results, see bench_regression
+
+static double seconds_since (const Clock::time_point start)
+{
+    return std::chrono::duration<double> (Clock::now () - start).count ();
+}
+
+static void report (const char *name, const double seconds, const double operations)
+{
+    printf ("%-40s %10.1f ns/op %12.0f op/s\n", name, seconds / operations * 1e9, operations / seconds);
+}
+
+/*
+** Coordinate parsing: SunWait's parser (through setCoordinates) against parseCoordinate
+*/
+static void bench_coordinates ()
+{
+    const int count = 1000000;
+    std::vector<std::string> latitudes, longitudes;
+    std::string buffer;
+    srand (1);
+    for (int i = 0; i < count; i++)
+    {
+        char text[32];
+        snprintf (text, sizeof (text), "%.6f%c", (rand () % 9000000) / 1e5, i % 2 ? 'N' : 'S');
+        latitudes.push_back (text);
+        snprintf (text, sizeof (text), "%.6f%c", (rand () % 18000000) / 1e5, i % 2 ? 'E' : 'W');
+        longitudes.push_back (text);
+        buffer += latitudes.back () + "\n" + longitudes.back () + "\n";
+    }
+
+    SunWait sw;
+    Clock::time_point start = Clock::now ();
+    int failed = 0;
+    for (int i = 0; i < count; i++)
+        if (!sw.setCoordinates (latitudes[i].c_str (), longitudes[i].c_str ())) failed++;
+    report ("coordinates: SunWait::setCoordinates", seconds_since (start), 2.0 * count);
+
+    start = Clock::now ();
+    double sum = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        sum += parseCoordinate (latitudes[i].data (), latitudes[i].size ()).value;
+        sum += parseCoordinate (longitudes[i].data (), longitudes[i].size ()).value;
+    }
+    report ("coordinates: parseCoordinate", seconds_since (start), 2.0 * count);
+
+    std::vector<CoordinateParse> results (2 * count);
+    start = Clock::now ();
+    size_t parsed = parseCoordinates (buffer.data (), buffer.size (), results.data (), results.size ());
+    report ("coordinates: parseCoordinates (bulk)", seconds_since (start), (double) parsed);
+
+    const char *dms = "52\xC2\xB0" "31'12.5\"N";
+    start = Clock::now ();
+    for (int i = 0; i < count; i++) sum += parseCoordinate (dms, strlen (dms)).value;
+    report ("coordinates: parseCoordinate (DMS)", seconds_since (start), count);
+
+    if (failed != 0 || sum == 0.0) printf ("coordinates: %d failed\n", failed);
+}
+
+/*
+** Time formatting: strftime on localtime_r against formatTime, and printf against EventWriter (to /dev/null)
+*/
+static void bench_formatter ()
+{
+    const int count = 1000000;
+    const time_t first = 1704067200;    // 2024-01-01
+    const time_t step = 31622400 / count;
+    size_t total = 0;
+
+    Clock::time_point start = Clock::now ();
+    for (int i = 0; i < count; i++)
+    {
+        time_t t = first + i * step;
+        struct tm localTm;
+        char buffer[32];
+        localtime_r (&t, &localTm);
+        total += strftime (buffer, sizeof (buffer), "%Y-%m-%dT%H:%M:%S", &localTm);
+    }
+    report ("formatter: localtime_r + strftime", seconds_since (start), count);
+
+    start = Clock::now ();
+    UtcOffsetTable zone (first, first + count * step);
+    report ("formatter: UtcOffsetTable (1 year)", seconds_since (start), 1);
+
+    const TimeFormat formats[] = { TIME_FORMAT_HHMM, TIME_FORMAT_ISO8601, TIME_FORMAT_EPOCH };
+    const char *names[] = { "formatter: formatTime (HH:MM)", "formatter: formatTime (ISO 8601)",
+                            "formatter: formatTime (epoch)" };
+    for (int f = 0; f < 3; f++)
+    {
+        start = Clock::now ();
+        for (int i = 0; i < count; i++)
+        {
+            time_t t = first + i * step;
+            char buffer[FORMAT_TIME_MAX];
+            total += formatTime (buffer, t, formats[f], zone.offset (t));
+        }
+        report (names[f], seconds_since (start), count);
+    }
+
+    FILE *null = fopen ("/dev/null", "w");
+    if (null == nullptr) return;
+    start = Clock::now ();
+    for (int i = 0; i < count; i++)
+    {
+        time_t t = first + i * step;
+        struct tm localTm;
+        localtime_r (&t, &localTm);
+        fprintf (null, "%02d:%02d, %02d:%02d\n", localTm.tm_hour, localTm.tm_min, localTm.tm_hour, localTm.tm_min);
+    }
+    report ("formatter: fprintf (list line)", seconds_since (start), count);
+
+    start = Clock::now ();
+    {
+        EventWriter writer (null, TIME_FORMAT_HHMM, &zone);
+        for (int i = 0; i < count; i++)
+        {
+            time_t t = first + i * step;
+            writer.time (t);
+            writer.text (", ");
+            writer.time (t);
+            writer.character ('\n');
+        }
+    }
+    report ("formatter: EventWriter (list line)", seconds_since (start), count);
+    fclose (null);
+
+    if (total == 0) printf ("formatter: no output\n");
+}
+
+/*
+** Reports: one SunWait::report per site against the batch variant
+*/
+static void bench_report ()
+{
+    const int count = 100000;
+    std::vector<SunSite> sites;
+    srand (2);
+    for (int i = 0; i < count; i++)
+        sites.push_back (SunSite ((rand () % 17000) / 100.0 - 85.0, (rand () % 36000) / 100.0 - 180.0));
+    const time_t now = 1718000000;
+    double sum = 0.0;
+
+    Clock::time_point start = Clock::now ();
+    for (int i = 0; i < count; i++)
+    {
+        SunWait sw (sites[i].latitude, sites[i].longitude);
+        sw.utc = true;
+        sum += sw.report (24, 6, 10, now).daylight.diurnalArc;
+    }
+    report ("report: SunWait::report", seconds_since (start), count);
+
+    std::vector<SunReport> reports (count);
+    SunWait sw;
+    sw.utc = true;
+    start = Clock::now ();
+    sw.report (sites.data (), sites.size (), reports.data (), 24, 6, 10, now);
+    report ("report: SunWait::report (batch)", seconds_since (start), count);
+
+    for (const SunReport &r : reports) sum -= r.daylight.diurnalArc;
+    if (sum > 1e-6 || sum < -1e-6) printf ("report: batch differs by %g hours\n", sum);
+}
+
+/*
+** Event stream of many sites: SunSweep against the rise and set times of SunWait::list, day by day.
+** They are the same except where the south hour of Sun::riset wraps around midnight UTC (sites near the
+** date line): list then skips or repeats an event, while SunSweep keeps the south hour within 12 hours of
+** mean solar noon and takes the events of the neighbouring day.
+*/
+static const int cSweepMonths[][4] = { { 23, 12, 31, 1 }, { 24, 1, 1, 31 }, { 24, 2, 1, 29 }, { 24, 3, 1, 1 } };   // list: year, month, day, days
+
+static void bench_sweep ()
+{
+    const int sites = 1000, days = 60;
+    const time_t t0 = 1704067200;   // 2024-01-01 00:00 UTC
+    const time_t t1 = t0 + (time_t) days * 86400;
+    const double angles[] = { TWILIGHT_ANGLE_DAYLIGHT, TWILIGHT_ANGLE_CIVIL, TWILIGHT_ANGLE_NAUTICAL,
+                              TWILIGHT_ANGLE_ASTRONOMICAL
+                            };
+    std::vector<SunSite> siteSet;
+    srand (4);
+    for (int s = 0; s < sites; s++)
+        siteSet.push_back (SunSite ((rand () % 14000) / 100.0 - 70.0, (rand () % 36000) / 100.0 - 180.0, angles[s % 4],
+                                    (s % 3) * 0.25));
+
+    std::vector<std::vector<time_t>> swept (sites);
+    size_t events = 0;
+    Clock::time_point start = Clock::now ();
+    SunSweep sweep (siteSet, t0, t1);
+    SunEvent event;
+    while (sweep.next (event))
+    {
+        swept[event.site].push_back (event.time);
+        events++;
+    }
+    report ("sweep: SunSweep (per event)", seconds_since (start), (double) events);
+
+    size_t equal = 0, missing = 0, dateLineEvents = 0, dateLineEqual = 0;
+    double maxDifference = 0.0;
+    start = Clock::now ();
+    for (int s = 0; s < sites; s++)
+    {
+        const SunSite &site = siteSet[s];
+        SunWait sw (site.latitude, site.longitude);
+        sw.twilightAngle = site.twilightAngle;
+        sw.offsetHour = site.offsetHour;
+        sw.utc = true;
+        std::vector<time_t> listed;
+        for (const int *month : cSweepMonths)
+        {
+            std::pair<std::vector<time_t>, std::vector<time_t>> list = sw.list (month[3], month[0], month[1], month[2]);
+            for (const std::vector<time_t> *times : { &list.first, &list.second })
+                for (time_t t : *times)
+                    if (t != POLAR_DAY && t != POLAR_NIGHT && t >= t0 && t < t1) listed.push_back (t);
+        }
+        std::sort (listed.begin (), listed.end ());
+
+        const bool dateLine = fabs (site.longitude) > 165.0;
+        if (!dateLine && listed.size () != swept[s].size ())
+            missing += listed.size () > swept[s].size () ? listed.size () - swept[s].size () : swept[s].size () - listed.size ();
+        for (time_t t : swept[s])
+        {
+            std::vector<time_t>::iterator after = std::lower_bound (listed.begin (), listed.end (), t);
+            double difference = 1e9;
+            if (after != listed.end ()) difference = (double) (*after - t);
+            if (after != listed.begin ()) difference = fmin (difference, (double) (t - *(after - 1)));
+            if (dateLine)
+            {
+                dateLineEvents++;
+                if (difference == 0.0) dateLineEqual++;
+            }
+            else if (difference == 0.0) equal++;
+            else maxDifference = fmax (maxDifference, difference);
+        }
+    }
+    report ("sweep: SunWait::list (per event)", seconds_since (start), (double) events);
+
+    bool passed = missing == 0 && maxDifference == 0.0;
+    printf ("sweep: %zu of %zu events equal to SunWait::list (up to %.0f s apart), %zu missing; near the date line %zu of %zu: %s\n",
+            equal, events - dateLineEvents, maxDifference, missing, dateLineEqual, dateLineEvents, passed ? "ok" : "FAILED");
+    if (!passed) benchFailed = true;
+}
+
+/*
+** Cancellable wait: time from WaitToken::cancel() / changed() until the waits have returned, while every
+** core is busy computing sun arcs
+*/
+static void cancel_round (WaitToken &token, const bool cancel, const int waiters, std::vector<double> &latencies)
+{
+    std::vector<Clock::time_point> returned (waiters);
+    std::vector<std::thread> threads;
+    std::atomic<int> started (0);
+    for (int i = 0; i < waiters; i++)
+        threads.push_back (std::thread ([&, i] ()
+        {
+            SunWait sw (52.0 + i * 0.01, -1.0);
+            started++;
+            int result = sw.wait (true, true, token, 3600.0);
+            returned[i] = Clock::now ();
+            if (result != (cancel ? EXIT_CANCELLED : EXIT_CHANGED)) printf ("cancel: wait returned %d\n", result);
+        }));
+    while (started < waiters) std::this_thread::yield ();
+    std::this_thread::sleep_for (std::chrono::milliseconds (20));
+
+    Clock::time_point signalled = Clock::now ();
+    if (cancel) token.cancel ();
+    else token.changed ();
+    for (std::thread &thread : threads) thread.join ();
+    if (cancel) token.reset ();
+
+    for (const Clock::time_point &t : returned) latencies.push_back (std::chrono::duration<double> (t - signalled).count ());
+}
+
+static void print_latencies (const char *name, std::vector<double> &latencies)
+{
+    std::sort (latencies.begin (), latencies.end ());
+    printf ("%-40s p50 %8.1f us  p99 %8.1f us  max %8.1f us\n", name, latencies[latencies.size () / 2] * 1e6,
+            latencies[latencies.size () * 99 / 100] * 1e6, latencies.back () * 1e6);
+}
+
+static void bench_cancel ()
+{
+    const int waiters = 16;
+    const int rounds = 50;
+    std::atomic<bool> loaded (true);
+    std::vector<std::thread> load;
+    unsigned cores = std::thread::hardware_concurrency ();
+    for (unsigned i = 0; i < (cores ? cores : 1); i++)
+        load.push_back (std::thread ([&loaded, i] ()
+        {
+            SunWait sw (10.0 * i, 0.0);
+            sw.utc = true;
+            double sum = 0.0;
+            while (loaded) sum += sw.report (24, 6, 10, 1718000000).daylight.diurnalArc;
+            if (sum < 0.0) printf ("cancel: negative day length\n");
+        }));
+
+    WaitToken token;
+    std::vector<double> cancelled, changed;
+    for (int round = 0; round < rounds; round++)
+    {
+        cancel_round (token, true, waiters, cancelled);
+        cancel_round (token, false, waiters, changed);
+    }
+
+    std::vector<double> timeouts;
+    for (int round = 0; round < 20; round++)
+    {
+        SunWait sw (52.0, -1.0);
+        Clock::time_point start = Clock::now ();
+        int result = sw.wait (true, true, token, 0.01);
+        if (result != EXIT_TIMEOUT) printf ("cancel: timeout wait returned %d\n", result);
+        timeouts.push_back (seconds_since (start) - 0.01);
+    }
+
+    loaded = false;
+    for (std::thread &thread : load) thread.join ();
+
+    print_latencies ("cancel: WaitToken::cancel", cancelled);
+    print_latencies ("cancel: WaitToken::changed", changed);
+    print_latencies ("cancel: timeout overshoot", timeouts);
+}
+
+/*
+** Simulation: ten years of schedules on a virtual clock, and every event of list() found among the fired events
+*/
+static void bench_simulate ()
+{
+    const int count = 100;
+    const time_t from = 1577836800;    // 2020-01-01
+    const int days = 3653;
+    std::vector<SunSite> sites;
+    srand (4);
+    for (int i = 0; i < count; i++)
+        sites.push_back (SunSite ((rand () % 17000) / 100.0 - 85.0, (rand () % 36000) / 100.0 - 180.0,
+                                  (i % 4) * -6.0 + ((i % 4) ? 0.0 : TWILIGHT_ANGLE_DAYLIGHT)));
+
+    std::vector<SunSimulationEvent> events;
+    SunSimulation simulation (sites);
+    Clock::time_point start = Clock::now ();
+    size_t fired = simulation.run (from, from + days * 86400L, &events);
+    double seconds = seconds_since (start);
+    report ("simulate: event", seconds, (double) fired);
+    printf ("simulate: %d site-years in %.2f s, %zu events, %zu state mismatches\n", count * days / 365, seconds,
+            fired, simulation.mismatches);
+
+    ChebyshevEphemeris ephemeris;
+    SunSimulation fast (sites, &ephemeris);
+    start = Clock::now ();
+    fired = fast.run (from, from + days * 86400L);
+    report ("simulate: event (ephemeris)", seconds_since (start), (double) fired);
+
+    std::vector<std::vector<time_t>> fireTimes (count);
+    for (const SunSimulationEvent &e : events) fireTimes[e.site].push_back (e.time);
+
+    size_t listed = 0, found = 0, polar = 0;
+    for (int i = 0; i < count; i++)
+    {
+        SunWait sw (sites[i].latitude, sites[i].longitude, sites[i].twilightAngle);
+        sw.utc = true;
+        for (int day = 0; day < days; day++)
+        {
+            time_t t = from + day * 86400L;
+            struct tm date;
+            gmtime_r (&t, &date);
+            std::pair<std::vector<time_t>, std::vector<time_t>> times = sw.list (1, date.tm_year - 100, date.tm_mon + 1, date.tm_mday);
+            time_t eventTimes[2] = { times.first[0], times.second[0] };
+            for (time_t e : eventTimes)
+            {
+                if (e == POLAR_DAY || e == POLAR_NIGHT) { polar++; continue; }
+                if (e < from || e >= from + days * 86400L) continue;
+                listed++;
+                if (std::binary_search (fireTimes[i].begin (), fireTimes[i].end (), e)) found++;
+            }
+        }
+    }
+    printf ("simulate: %zu of %zu list() events fired (%zu polar days)\n", found, listed, polar / 2);
+}
+
+/*
+** Rules: next fire of 1M rules at 10000 sites from the prepared arcs, against computing the arcs per rule
+*/
+static void bench_rules ()
+{
+    const char *texts[] =
+    {
+        "sunset-30min on weekdays, not before 17:00 local",
+        "civil dawn or 06:30, whichever is later",
+        "sunrise + 15 min",
+        "nautical dusk on weekends",
+        "noon - 1h",
+        "sunset or 22:00",
+        "astronomical dawn not after 05:00",
+        "06:45 on mon-fri",
+    };
+    const int textCount = sizeof (texts) / sizeof (texts[0]);
+    const int sites = 10000;
+    const int count = 1000000;
+    const time_t now = 1718000000;
+
+    std::vector<double> latitudes, longitudes;
+    srand (5);
+    for (int i = 0; i < sites; i++)
+    {
+        latitudes.push_back ((rand () % 13000) / 100.0 - 65.0);
+        longitudes.push_back ((rand () % 36000) / 100.0 - 180.0);
+    }
+
+    Clock::time_point start = Clock::now ();
+    std::vector<SunRule> compiled (textCount);
+    for (int i = 0; i < count; i++) compileSunRule (texts[i % textCount], &compiled[i % textCount]);
+    report ("rules: compileSunRule", seconds_since (start), count);
+
+    UtcOffsetTable zone (now - 86400 * 7, now + 86400 * 400);
+    SunRuleSet rules (&zone);
+    for (int i = 0; i < count; i++) rules.add (latitudes[i % sites], longitudes[i % sites], compiled[(i / sites) % textCount]);
+
+    start = Clock::now ();
+    rules.prepare (now);
+    double seconds = seconds_since (start);
+    printf ("rules: prepare %zu arc sites x 12 days in %.3f s\n", rules.arcSites (), seconds);
+
+    std::vector<time_t> fires (count);
+    start = Clock::now ();
+    rules.nextFires (now, fires.data ());
+    report ("rules: SunRuleSet::nextFires (per rule)", seconds_since (start), count);
+
+    // The same rules, once from the prepared arcs and once computing them
+    const int sample = 80000;
+    SunRuleSet direct (&zone);
+    for (int i = 0; i < sample; i++) direct.add (latitudes[i % sites], longitudes[i % sites], compiled[(i / sites) % textCount]);
+    long sum = 0;
+    start = Clock::now ();
+    for (int i = 0; i < sample; i++) sum += rules.nextFire (i, now) - now;
+    report ("rules: nextFire (prepared arcs)", seconds_since (start), sample);
+
+    long differ = 0;
+    start = Clock::now ();
+    for (int i = 0; i < sample; i++)
+    {
+        time_t t = direct.nextFire (i, now);
+        if (t < fires[i] - 1 || t > fires[i] + 1) differ++;
+    }
+    report ("rules: nextFire (computed arcs)", seconds_since (start), sample);
+    if (sum == 0) printf ("rules: no fires\n");
+    if (differ) printf ("rules: %ld of %d fires differ by more than a second\n", differ, sample);
+}
+
+/*
+** Track: rise and set along a 10^6 point track (a ship at 20 knots, a point every 10 s) against poll() per point
+*/
+static void bench_track ()
+{
+    const size_t count = 1000000;
+    const time_t from = 1718000000;
+    std::vector<time_t> times (count);
+    std::vector<double> latitudes (count), longitudes (count);
+    for (size_t i = 0; i < count; i++)
+    {
+        double hours = i * 10.0 / 3600.0;
+        times[i] = from + (time_t) i * 10;
+        latitudes[i] = 60.0 * sin (hours / 500.0);               // north and south between 60S and 60N
+        longitudes[i] = fmod (-20.0 + hours / 3.0 + 540.0, 360.0) - 180.0;   // 20 knots east at the equator
+    }
+
+    std::vector<SunTrackEvent> events;
+    std::vector<unsigned char> isDay (count);
+    SunTrack track;
+    Clock::time_point start = Clock::now ();
+    size_t found = track.events (times.data (), latitudes.data (), longitudes.data (), count, events, isDay.data ());
+    report ("track: SunTrack::events (per point)", seconds_since (start), count);
+
+    ChebyshevEphemeris ephemeris;
+    SunTrack fast (TWILIGHT_ANGLE_DAYLIGHT, &ephemeris);
+    std::vector<SunTrackEvent> fastEvents;
+    start = Clock::now ();
+    fast.events (times.data (), latitudes.data (), longitudes.data (), count, fastEvents);
+    report ("track: SunTrack::events (ephemeris)", seconds_since (start), count);
+
+    const size_t sample = 20000;
+    long differ = 0;
+    start = Clock::now ();
+    for (size_t i = 0; i < sample; i++)
+    {
+        SunWait sw (latitudes[i], longitudes[i]);
+        if ((sw.poll (times[i]) == EXIT_DAY) != (bool) isDay[i]) differ++;
+    }
+    report ("track: SunWait::poll per point", seconds_since (start), sample);
+
+    double maxDifference = 0.0;
+    for (size_t i = 0; i < fastEvents.size () && i < events.size (); i++)
+        maxDifference = std::max (maxDifference, fabs (fastEvents[i].time - events[i].time));
+    printf ("track: %zu events, ephemeris within %.2f s; poll differs at %ld of %zu points\n", found, maxDifference,
+            differ, sample);
+}
+
+/*
+** Sensitivities of rise and set: Sun::riset with and without the analytic gradient, against central
+** finite differences (eight risets: latitude, longitude, angle and the neighbouring days)
+*/
+static void bench_gradient ()
+{
+    const int count = 200000;
+    const double h = 1e-4;
+    static const double cAngles[] = { TWILIGHT_ANGLE_DAYLIGHT, TWILIGHT_ANGLE_CIVIL, TWILIGHT_ANGLE_NAUTICAL,
+                                      TWILIGHT_ANGLE_ASTRONOMICAL
+                                    };
+    std::vector<double> latitudes (count), longitudes (count), angles (count);
+    std::vector<unsigned long> days (count);
+    srand (1);
+    for (int i = 0; i < count; i++)
+    {
+        latitudes[i] = rand () / (double) RAND_MAX * 140.0 - 70.0;
+        longitudes[i] = rand () / (double) RAND_MAX * 360.0 - 180.0;
+        angles[i] = cAngles[i % 4];
+        days[i] = 8000 + rand () % 3000;
+    }
+
+    double sum = 0.0;
+    Clock::time_point start = Clock::now ();
+    for (int i = 0; i < count; i++)
+    {
+        Sun sun(longitudes[i], latitudes[i], angles[i]);
+        sum += sun.riset (days[i]).diurnalArc;
+    }
+    report ("gradient: Sun::riset", seconds_since (start), count);
+
+    std::vector<SunArcGradient> gradients (count);
+    start = Clock::now ();
+    for (int i = 0; i < count; i++)
+    {
+        Sun sun(longitudes[i], latitudes[i], angles[i]);
+        sum += sun.riset (days[i], &gradients[i]).diurnalArc;
+    }
+    report ("gradient: Sun::riset with gradient", seconds_since (start), count);
+
+    std::vector<SunArcGradient> differences (count);
+    std::vector<char> usable (count);
+    start = Clock::now ();
+    for (int i = 0; i < count; i++)
+    {
+        const double lat = latitudes[i], lon = longitudes[i], angle = angles[i];
+        const unsigned long day = days[i];
+        SunArc arcs[8] = { Sun(lon, lat + h, angle).riset (day), Sun(lon, lat - h, angle).riset (day),
+                           Sun(lon + h, lat, angle).riset (day), Sun(lon - h, lat, angle).riset (day),
+                           Sun(lon, lat, angle + h).riset (day), Sun(lon, lat, angle - h).riset (day),
+                           Sun(lon, lat, angle).riset (day + 1), Sun(lon, lat, angle).riset (day - 1)
+                         };
+        differences[i].arcLatitude = (arcs[0].diurnalArc - arcs[1].diurnalArc) / (2.0 * h);
+        differences[i].southLongitude = (arcs[2].southHourUTC - arcs[3].southHourUTC) / (2.0 * h);
+        differences[i].arcAngle = (arcs[4].diurnalArc - arcs[5].diurnalArc) / (2.0 * h);
+        differences[i].arcDay = (arcs[6].diurnalArc - arcs[7].diurnalArc) / 2.0;
+        differences[i].southDay = (arcs[6].southHourUTC - arcs[7].southHourUTC) / 2.0;
+
+        // Differences across polar day or night mean nothing
+        usable[i] = 1;
+        for (const SunArc &arc : arcs)
+            if (arc.diurnalArc <= 0.0 || arc.diurnalArc >= 24.0) usable[i] = 0;
+    }
+    report ("gradient: finite differences (8 risets)", seconds_since (start), count);
+
+    // Median differences: the finite differences have their own truncation error, most of all
+    // over whole days close to the polar circles
+    std::vector<double> latitude, longitude, angle, day;
+    for (int i = 0; i < count; i++)
+    {
+        if (!usable[i]) continue;
+        latitude.push_back (fabs (gradients[i].riseLatitude () + differences[i].arcLatitude / 2.0) * 3600.0);
+        longitude.push_back (fabs (gradients[i].southLongitude - differences[i].southLongitude) * 3600.0);
+        angle.push_back (fabs (gradients[i].riseAngle () + differences[i].arcAngle / 2.0) * 3600.0);
+        day.push_back (fabs (gradients[i].riseDay () - (differences[i].southDay - differences[i].arcDay / 2.0)) * 3600.0);
+    }
+    auto median = [] (std::vector<double> &values) {
+        if (values.empty ()) return 0.0;
+        std::nth_element (values.begin (), values.begin () + values.size () / 2, values.end ());
+        return values[values.size () / 2];
+    };
+    printf ("gradient: %zu positions, median difference of the rise to finite differences: latitude %.4f s/deg, "
+            "longitude %.4f s/deg, angle %.4f s/deg, day %.4f s/day\n",
+            latitude.size (), median (latitude), median (longitude), median (angle), median (day));
+
+    // The first-order bound of the cache against its actual error
+    SunCache cache (10.0);
+    double maxBound = 0.0, maxActual = 0.0;
+    long exceeded = 0;
+    for (int i = 0; i < count; i += 10)
+    {
+        SunArc cached = cache.riset (latitudes[i], longitudes[i], angles[i], days[i]);
+        SunArc exact = Sun(longitudes[i], latitudes[i], angles[i]).riset (days[i]);
+        if (exact.diurnalArc <= 0.0 || exact.diurnalArc >= 24.0) continue;
+        double bound = cache.cellError (latitudes[i], longitudes[i], angles[i], days[i]);
+        double south = remainder (cached.southHourUTC - exact.southHourUTC, 24.0);
+        double actual = (fabs (south) + fabs (cached.diurnalArc - exact.diurnalArc) / 2.0) * 3600.0;
+        if (actual > bound + 0.01) exceeded++;
+        maxBound = fmax (maxBound, bound);
+        maxActual = fmax (maxActual, actual);
+    }
+    printf ("gradient: 10 s cache, first-order error up to %.2f s, actual up to %.2f s, above the estimate +0.01 s "
+            "at %ld positions (checksum %.0f)\n", maxBound, maxActual, exceeded, sum);
+}
+
+/*
+** Altitude contours: building the table of 1000 sites over a year, then rise and set for a slider of
+** twilight angles, against Sun::riset for every site, day and angle
+*/
+static void bench_contour ()
+{
+    const int sites = 1000, days = 365, angles = 29;   // -18 to +10 degrees
+    const unsigned long firstDay = 9000;
+    std::vector<SunSite> siteSet;
+    srand (1);
+    for (int s = 0; s < sites; s++)
+        siteSet.push_back (SunSite(rand () / (double) RAND_MAX * 140.0 - 70.0, rand () / (double) RAND_MAX * 360.0 - 180.0));
+
+    Clock::time_point start = Clock::now ();
+    SunContour contour (siteSet, firstDay, days);
+    report ("contour: build (per site and day)", seconds_since (start), (double) sites * days);
+
+    std::vector<SunArc> arcs (sites, SunArc(0.0, 0.0));
+    double sum = 0.0;
+    start = Clock::now ();
+    for (int day = 0; day < days; day++)
+        for (int a = 0; a < angles; a++)
+        {
+            contour.riset (firstDay + day, -18.0 + a, arcs.data ());
+            for (const SunArc &arc : arcs) sum += arc.diurnalArc;
+        }
+    report ("contour: SunContour::riset", seconds_since (start), (double) sites * days * angles);
+
+    start = Clock::now ();
+    for (int day = 0; day < days; day++)
+        for (int a = 0; a < angles; a++)
+            for (int s = 0; s < sites; s++)
+            {
+                Sun sun(siteSet[s].longitude, siteSet[s].latitude, -18.0 + a);
+                sum += sun.riset (firstDay + day).diurnalArc;
+            }
+    report ("contour: Sun::riset", seconds_since (start), (double) sites * days * angles);
+
+    double maxDifference = 0.0;
+    for (int day = 0; day < days; day += 7)
+        for (int a = 0; a < angles; a++)
+            for (int s = 0; s < sites; s++)
+            {
+                SunArc exact = Sun(siteSet[s].longitude, siteSet[s].latitude, -18.0 + a).riset (firstDay + day);
+                SunArc table = contour.riset (s, firstDay + day, -18.0 + a);
+                double south = remainder (table.southHourUTC - exact.southHourUTC, 24.0);
+                maxDifference = fmax (maxDifference, fabs (south) + fabs (table.diurnalArc - exact.diurnalArc) / 2.0);
+            }
+
+    SunArc daylight = contour.riset (0, firstDay, TWILIGHT_ANGLE_DAYLIGHT);
+    SunArc exact = Sun(siteSet[0].longitude, siteSet[0].latitude, TWILIGHT_ANGLE_DAYLIGHT).riset (firstDay);
+    printf ("contour: rise and set within %.2g s of Sun::riset (daylight, upper limb: %.2g s); "
+            "site 0 altitude %.2f to %.2f deg (checksum %.0f)\n", maxDifference * 3600.0,
+            fabs (daylight.diurnalArc - exact.diurnalArc) * 1800.0, contour.minAltitude (0, firstDay),
+            contour.maxAltitude (0, firstDay), sum);
+}
+
+/*
+** Daylight statistics of 1000 sites over three years, against summing the arcs of Sun::riset at the four altitudes
+*/
+static void bench_daylight ()
+{
+    const int sites = 1000, days = 1096;
+    const unsigned long firstDay = 8766;   // 2024-01-01
+    std::vector<SunSite> siteSet;
+    srand (1);
+    for (int s = 0; s < sites; s++)
+        siteSet.push_back (SunSite(rand () / (double) RAND_MAX * 180.0 - 90.0, rand () / (double) RAND_MAX * 360.0 - 180.0));
+
+    SunDaylight daylight (siteSet);
+    std::vector<SunDaylightStats> months, years;
+    Clock::time_point start = Clock::now ();
+    daylight.aggregate (firstDay, days, &months, &years);
+    report ("daylight: SunDaylight::aggregate (per site and day)", seconds_since (start), (double) sites * days);
+
+    static const double cAngles[] = { TWILIGHT_ANGLE_DAYLIGHT, TWILIGHT_ANGLE_CIVIL, TWILIGHT_ANGLE_NAUTICAL,
+                                      TWILIGHT_ANGLE_ASTRONOMICAL
+                                    };
+    std::vector<double> totals ((size_t) sites * 4, 0.0);
+    start = Clock::now ();
+    for (int day = 0; day < days; day++)
+        for (int s = 0; s < sites; s++)
+            for (int k = 0; k < 4; k++)
+            {
+                Sun sun(siteSet[s].longitude, siteSet[s].latitude, cAngles[k]);
+                totals[s * 4 + k] += sun.riset (firstDay + day).diurnalArc;
+            }
+    report ("daylight: Sun::riset x 4 (per site and day)", seconds_since (start), (double) sites * days);
+
+    // Sum of the years against the sums of the arcs: daylight, and daylight plus each twilight band
+    double maxDifference = 0.0;
+    for (int s = 0; s < sites; s++)
+    {
+        double sums[4] = { 0.0, 0.0, 0.0, 0.0 };
+        for (size_t p = 0; p < years.size () / sites; p++)
+        {
+            const SunDaylightStats &stats = years[p * sites + s];
+            sums[0] += stats.totalDaylight;
+            sums[1] += stats.totalDaylight + stats.civilTwilight;
+            sums[2] += stats.totalDaylight + stats.civilTwilight + stats.nauticalTwilight;
+            sums[3] += stats.totalDaylight + stats.civilTwilight + stats.nauticalTwilight + stats.astronomicalTwilight;
+        }
+        for (int k = 0; k < 4; k++) maxDifference = fmax (maxDifference, fabs (sums[k] - totals[s * 4 + k]));
+    }
+    const SunDaylightStats &june = months[5 * sites];
+    printf ("daylight: %zu months, %zu years, totals within %.2g h of Sun::riset; site 0 (%.1f) June %d: "
+            "%.2f h mean daylight, %.2f to %.2f h\n", months.size () / sites, years.size () / sites, maxDifference,
+            siteSet[0].latitude, june.year, june.meanDaylight, june.minDaylight, june.maxDaylight);
+}
+
+/*
+** Clear-sky irradiance: a day of 5-minute slots for 5000 plants, in batch and point by point
+*/
+static void bench_irradiance ()
+{
+    const int plants = 5000, slots = 288, step = 300;
+    const time_t start = 1718928000;   // 2024-06-21 00:00 UTC
+    std::vector<SunPlant> plantSet;
+    srand (1);
+    for (int p = 0; p < plants; p++)
+        plantSet.push_back (SunPlant(rand () / (double) RAND_MAX * 120.0 - 60.0, rand () / (double) RAND_MAX * 360.0 - 180.0,
+                                     rand () % 2000, 2.0 + rand () / (double) RAND_MAX * 3.0));
+
+    std::vector<float> series ((size_t) plants * slots);
+    for (SunClearSkyModel model : { SUN_CLEAR_SKY_HAURWITZ, SUN_CLEAR_SKY_INEICHEN })
+    {
+        SunIrradiance irradiance (plantSet, model);
+        Clock::time_point begin = Clock::now ();
+        irradiance.ghi (start, step, slots, series.data ());
+        report (model == SUN_CLEAR_SKY_HAURWITZ ? "irradiance: batch, Haurwitz (per value)"
+                                                : "irradiance: batch, Ineichen (per value)",
+                seconds_since (begin), (double) plants * slots);
+    }
+
+    // The same values one plant and instant at a time, on a sample
+    SunIrradiance irradiance (plantSet);
+    const int sample = 20000;
+    double maxDifference = 0.0, energy = 0.0;
+    Clock::time_point begin = Clock::now ();
+    for (int i = 0; i < sample; i++)
+    {
+        size_t p = (size_t) i * 7919 % plants;
+        int slot = i % slots;
+        double value = irradiance.ghi (p, (double) start + (double) slot * step);
+        maxDifference = fmax (maxDifference, fabs (value - series[(size_t) slot * plants + p]));
+    }
+    report ("irradiance: SunIrradiance::ghi per value", seconds_since (begin), sample);
+
+    for (int slot = 0; slot < slots; slot++) energy += series[(size_t) slot * plants] * step / 3600.0;
+    printf ("irradiance: batch within %.3f W/m^2 of single values; plant 0 (%.1f, %.1f): %.2f kWh/m^2 on the day\n",
+            maxDifference, plantSet[0].latitude, plantSet[0].longitude, energy / 1000.0);
+}
+
+/*
+** Facade exposure: 10 buildings of 1000 facades over 30 days, in one batch and one facade at a time
+*/
+static void bench_facade ()
+{
+    const int buildings = 10, perBuilding = 1000, days = 30;
+    const time_t from = 1718841600;   // 2024-06-20 00:00 UTC
+    std::vector<SunFacade> facades;
+    srand (1);
+    for (int b = 0; b < buildings; b++)
+    {
+        double lat = rand () / (double) RAND_MAX * 120.0 - 60.0, lon = rand () / (double) RAND_MAX * 360.0 - 180.0;
+        for (int f = 0; f < perBuilding; f++)
+        {
+            double facing = (f % 16) * 22.5;   // orientation of the facade's normal
+            facades.push_back (SunFacade(lat, lon, facing - 90.0, facing + 90.0, (f / 16) % 4 * 5.0));
+        }
+    }
+
+    SunExposure exposure (facades);
+    std::vector<SunFacadeEvent> events;
+    Clock::time_point start = Clock::now ();
+    size_t found = exposure.events (from, from + days * 86400, events);
+    report ("facade: SunExposure::events (per facade and day)", seconds_since (start), (double) facades.size () * days);
+
+    const int sample = 20;
+    start = Clock::now ();
+    for (int i = 0; i < sample; i++)
+    {
+        std::vector<SunFacade> one (1, facades[(size_t) i * 499 % facades.size ()]);
+        std::vector<SunFacadeEvent> oneEvents;
+        SunExposure(one).events (from, from + days * 86400, oneEvents);
+    }
+    report ("facade: one facade at a time (per facade and day)", seconds_since (start), (double) sample * days);
+
+    std::vector<double> crossings;
+    start = Clock::now ();
+    exposure.crossings (facades[0].latitude, facades[0].longitude, 135.0, 5.0, from, from + days * 86400, crossings);
+    report ("facade: SunExposure::crossings (per day)", seconds_since (start), days);
+    printf ("facade: %zu events, %.1f per facade and day; %zu crossings of azimuth 135 deg\n", found,
+            found / (double) facades.size () / days, crossings.size ());
+}
+
+/*
+** Terrain horizon: rise and set over an alpine profile from the lookup, against Sun::riset on a flat horizon
+** and against sampling the sun's path every minute
+*/
+static void bench_horizon ()
+{
+    const double latitude = 47.0, longitude = 11.4;
+    const double azimuths[] = { 0.0, 60.0, 90.0, 100.0, 105.0, 150.0, 180.0, 240.0, 270.0, 300.0 };
+    const double altitudes[] = { 3.0, 12.0, 14.0, 4.0, 13.0, 8.0, 2.0, 6.0, 9.0, 5.0 };
+    const int days = 3650;
+    const unsigned long firstDay = 8766;
+
+    SunHorizon horizon (latitude, longitude, 800.0);
+    Clock::time_point start = Clock::now ();
+    horizon.setProfile (azimuths, altitudes, sizeof (azimuths) / sizeof (azimuths[0]));
+    report ("horizon: SunHorizon::setProfile", seconds_since (start), 1);
+
+    double sum = 0.0;
+    start = Clock::now ();
+    for (int day = 0; day < days; day++) sum += horizon.riset (firstDay + day).riseHourUTC;
+    report ("horizon: SunHorizon::riset", seconds_since (start), days);
+
+    start = Clock::now ();
+    for (int day = 0; day < days; day++)
+        sum += Sun(longitude, latitude, TWILIGHT_ANGLE_DAYLIGHT).riset (firstDay + day).diurnalArc;
+    report ("horizon: Sun::riset (flat)", seconds_since (start), days);
+
+    // Brute force: the first and last minute the sun's limb is above the horizon
+    const int sample = 50;
+    double maxDifference = 0.0;
+    start = Clock::now ();
+    for (int i = 0; i < sample; i++)
+    {
+        unsigned long day = firstDay + i * 73;
+        double ra, dec, r;
+        Sun::sun_RA_dec (day + 1.5, &ra, &dec, &r);  // As Sun::riset, at noon UTC
+        SunArc arc = Sun(longitude, latitude, TWILIGHT_ANGLE_DAYLIGHT).riset (day);
+        double first = -1.0;
+        for (int minute = 0; minute <= 1440; minute++)
+        {
+            double hourAngle = (minute / 60.0 - 12.0) * 15.0;
+            double sinAltitude = sind(latitude) * sind(dec) + cosd(latitude) * cosd(dec) * cosd(hourAngle);
+            double azimuth = atan2d(-cosd(dec) * sind(hourAngle), sind(dec) * cosd(latitude) - cosd(dec) * cosd(hourAngle) * sind(latitude));
+            if (asind(sinAltitude) - (TWILIGHT_ANGLE_DAYLIGHT) + 0.2666 / r > horizon.horizonAltitude (azimuth))
+            {
+                first = minute / 60.0 - 12.0;
+                break;
+            }
+        }
+        if (first >= -12.0) maxDifference = fmax (maxDifference, fabs (arc.southHourUTC + first - horizon.riset (day).riseHourUTC));
+    }
+    report ("horizon: sampling every minute", seconds_since (start), sample);
+
+    SunHorizonDay solstice = horizon.riset (8937);
+    SunArc flat = Sun(longitude, latitude, TWILIGHT_ANGLE_DAYLIGHT).riset (8937);
+    printf ("horizon: minute sampling within %.0f s; 2024-06-20 rise %.0f min after the flat horizon, set %.0f min "
+            "before (dip %.2f deg, checksum %.0f)\n", maxDifference * 3600.0,
+            (solstice.riseHourUTC - flat.southHourUTC + flat.diurnalArc / 2.0) * 60.0,
+            (flat.southHourUTC + flat.diurnalArc / 2.0 - solstice.setHourUTC) * 60.0, horizon.dip (), sum);
+}
+
+/*
+** Solar position backends: cost and accuracy of each, and what the difference does to rise and set times
+*/
+static void bench_backends ()
+{
+    const SunPositionBackend backends[] = { SUN_POSITION_SCHLYTER, SUN_POSITION_NOAA };
+    for (SunPositionBackend backend : backends)
+    {
+        SunPositionInfo info = SunWait::positionInfo (backend, 200000);
+        printf ("backends: %-8s %6.1f ns/evaluation, nominal error %.4f deg, deviation from noaa %.4f deg (GMST0 %.4f deg)\n",
+                info.name, info.nsPerEvaluation, info.nominalError, info.deviationFromNOAA, info.siderealDeviationFromNOAA);
+    }
+
+    const int days = 3650;
+    const unsigned long firstDay = 8766;
+    const double latitudes[] = { -60.0, -35.0, 0.0, 35.0, 60.0 };
+    double sum = 0.0;
+    Clock::time_point start = Clock::now ();
+    for (double latitude : latitudes)
+        for (int day = 0; day < days; day++) sum += Sun(11.4, latitude, TWILIGHT_ANGLE_DAYLIGHT).riset (firstDay + day).diurnalArc;
+    report ("backends: Sun::riset", seconds_since (start), days * 5);
+
+    start = Clock::now ();
+    for (double latitude : latitudes)
+        for (int day = 0; day < days; day++) sum += SunNOAA(11.4, latitude, TWILIGHT_ANGLE_DAYLIGHT).riset (firstDay + day).diurnalArc;
+    report ("backends: SunNOAA::riset", seconds_since (start), days * 5);
+
+    // Rise and set: Schlyter against NOAA
+    double maxDifference = 0.0;
+    for (double latitude : latitudes)
+    {
+        for (int day = 0; day < days; day++)
+        {
+            SunArc fast = Sun(11.4, latitude, TWILIGHT_ANGLE_DAYLIGHT).riset (firstDay + day);
+            SunArc accurate = SunNOAA(11.4, latitude, TWILIGHT_ANGLE_DAYLIGHT).riset (firstDay + day);
+            double south = fast.southHourUTC - accurate.southHourUTC;
+            double half = (fast.diurnalArc - accurate.diurnalArc) / 2.0;
+            maxDifference = fmax (maxDifference, fmax (fabs (south - half), fabs (south + half)));
+        }
+    }
+    printf ("backends: rise and set within %.1f s of NOAA at latitudes up to 60 deg, 2024-2033 (checksum %.0f)\n",
+            maxDifference * 3600.0, sum);
+}
+
+/*
+** Regression suite: event times of every path on a fixed grid of sites (9 latitudes, 4 twilight angles),
+** years 1900-2100 and six days a year, against the reference events of reference.hpp. The reference solves
+** for the instants the sun crosses the altitude of the twilight angle (the upper limb at
+** TWILIGHT_ANGLE_DAYLIGHT, as Sun::riset) with the apparent position at that instant from the VSOP87 series
+** of reference.hpp, which none of the backends under test share; Sun::riset takes one position (at noon UTC)
+** for the whole day. The errors of the scalar path are thus mostly those of its method, largest where the
+** sun barely reaches the altitude. The paths which take the position at the instant (SunTrack,
+** SunExposure) follow the reference closely; SunIrradiance, which has no events, is checked by its
+** irradiance instead.
+*/
+static const double cRegressionLatitudes[] = { -70.0, -55.0, -40.0, -20.0, 0.0, 20.0, 40.0, 55.0, 70.0 };
+static const double cRegressionAngles[] = { TWILIGHT_ANGLE_DAYLIGHT, TWILIGHT_ANGLE_CIVIL, TWILIGHT_ANGLE_NAUTICAL,
+                                            TWILIGHT_ANGLE_ASTRONOMICAL
+                                          };
+static const int cRegressionDaysOfYear[] = { 0, 59, 120, 181, 243, 304 };
+
+static std::vector<SunSite> regressionSites ()
+{
+    std::vector<SunSite> sites;
+    for (double latitude : cRegressionLatitudes)
+        for (double angle : cRegressionAngles)
+            sites.push_back (SunSite (latitude, -165.0 + fmod (37.0 * sites.size (), 330.0), angle));
+    return sites;
+}
+
+static std::vector<long> regressionDays ()
+{
+    std::vector<long> days;
+    for (int year = 1900; year <= 2100; year += 20)
+        for (int dayOfYear : cRegressionDaysOfYear) days.push_back (lround ((year - 2000) * 365.2425) + dayOfYear);
+    return days;
+}
+
+/* Sum of the terms of one series of reference.hpp, in units of 1e-8 */
+template <size_t terms>
+static double vsopSeries (const double (&series)[terms][3], const double tau)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < terms; i++) sum += series[i][0] * cos (series[i][1] + series[i][2] * tau);
+    return sum;
+}
+
+/* Terrestrial time minus universal time, seconds (Espenak and Meeus, 1900-2150) */
+static double referenceDeltaT (const double year)
+{
+    if (year < 1920.0)
+    {
+        double t = year - 1900.0;
+        return -2.79 + 1.494119 * t - 0.0598939 * t * t + 0.0061966 * t * t * t - 0.000197 * t * t * t * t;
+    }
+    if (year < 1941.0)
+    {
+        double t = year - 1920.0;
+        return 21.20 + 0.84493 * t - 0.076100 * t * t + 0.0020936 * t * t * t;
+    }
+    if (year < 1961.0)
+    {
+        double t = year - 1950.0;
+        return 29.07 + 0.407 * t - t * t / 233.0 + t * t * t / 2547.0;
+    }
+    if (year < 1986.0)
+    {
+        double t = year - 1975.0;
+        return 45.45 + 1.067 * t - t * t / 260.0 - t * t * t / 718.0;
+    }
+    if (year < 2005.0)
+    {
+        double t = year - 2000.0;
+        return 63.86 + 0.3345 * t - 0.060374 * t * t + 0.0017275 * t * t * t + 0.000651814 * t * t * t * t
+               + 0.00002373599 * t * t * t * t * t;
+    }
+    if (year < 2050.0)
+    {
+        double t = year - 2000.0;
+        return 62.92 + 0.32217 * t + 0.005589 * t * t;
+    }
+    double u = (year - 1820.0) / 100.0;
+    return -20.0 + 32.0 * u * u - 0.5628 * (2150.0 - year);
+}
+
+/*
+** Apparent right ascension and declination (degrees), distance (astronomical units) and apparent sidereal
+** time at Greenwich (degrees) at a Julian day (UT): the VSOP87 series of reference.hpp with the FK5
+** correction, aberration and the main terms of the nutation (Meeus, Astronomical Algorithms, chapters
+** 12, 22 and 25).
+*/
+static void referencePosition (const double jd, double *ra, double *dec, double *r, double *siderealTime)
+{
+    const double arcsecond = 1.0 / 3600.0;
+    double jde = jd + referenceDeltaT (2000.0 + (jd - 2451545.0) / 365.25) / 86400.0;
+    double T = (jde - 2451545.0) / 36525.0, tau = T / 10.0;
+
+    double L = (vsopSeries (cEarthL0, tau) + tau * (vsopSeries (cEarthL1, tau) + tau * (vsopSeries (cEarthL2, tau)
+               + tau * (vsopSeries (cEarthL3, tau) + tau * (vsopSeries (cEarthL4, tau) + tau * vsopSeries (cEarthL5, tau)))))) * 1e-8;
+    double B = (vsopSeries (cEarthB0, tau) + tau * vsopSeries (cEarthB1, tau)) * 1e-8;
+    *r = (vsopSeries (cEarthR0, tau) + tau * (vsopSeries (cEarthR1, tau) + tau * (vsopSeries (cEarthR2, tau)
+         + tau * (vsopSeries (cEarthR3, tau) + tau * vsopSeries (cEarthR4, tau))))) * 1e-8;
+
+    // Geocentric longitude and latitude of the sun in the FK5 system, degrees
+    double longitude = L * RADIAN_TO_DEGREE + 180.0, latitude = -B * RADIAN_TO_DEGREE;
+    double shifted = longitude - 1.397 * T - 0.00031 * T * T;
+    longitude += (-0.09033 + 0.03916 * (cosd(shifted) + sind(shifted)) * tand(latitude)) * arcsecond;
+    latitude  += 0.03916 * (cosd(shifted) - sind(shifted)) * arcsecond;
+
+    // Nutation and the true obliquity of the ecliptic
+    double node = 125.04452 - 1934.136261 * T + 0.0020708 * T * T + T * T * T / 450000.0;
+    double sunMean = 280.4665 + 36000.7698 * T, moonMean = 218.3165 + 481267.8813 * T;
+    double nutationLongitude = (-17.20 * sind(node) - 1.32 * sind(2.0 * sunMean) - 0.23 * sind(2.0 * moonMean)
+                                + 0.21 * sind(2.0 * node)) * arcsecond;
+    double nutationObliquity = (9.20 * cosd(node) + 0.57 * cosd(2.0 * sunMean) + 0.10 * cosd(2.0 * moonMean)
+                                - 0.09 * cosd(2.0 * node)) * arcsecond;
+    double obliquity = 23.0 + 26.0 / 60.0 + (21.448 - 46.8150 * T - 0.00059 * T * T + 0.001813 * T * T * T) * arcsecond
+                       + nutationObliquity;
+
+    // Apparent longitude (nutation and aberration) to equatorial coordinates
+    longitude += nutationLongitude - 20.4898 * arcsecond / *r;
+    *ra  = atan2d(sind(longitude) * cosd(obliquity) - tand(latitude) * sind(obliquity), cosd(longitude));
+    *dec = asind(sind(latitude) * cosd(obliquity) + cosd(latitude) * sind(obliquity) * sind(longitude));
+
+    // Mean sidereal time (IAU 1982) and the equation of the equinoxes
+    double Tu = (jd - 2451545.0) / 36525.0;
+    *siderealTime = 280.46061837 + 360.98564736629 * (jd - 2451545.0) + 0.000387933 * Tu * Tu - Tu * Tu * Tu / 38710000.0
+                    + nutationLongitude * cosd(obliquity);
+}
+
+/* Altitude of the sun above the event altitude of the site, and its hour angle, hour UTC of the day */
+static double referenceAltitude (const SunSite &site, const long day, const double hour, double *hourAngle = nullptr)
+{
+    double ra, dec, r, siderealTime;
+    referencePosition (2451544.5 + day + hour / 24.0, &ra, &dec, &r, &siderealTime); // Julian day of 2000-01-01 is 2451544.5
+    double angle = siderealTime + site.longitude - ra;
+    if (hourAngle != nullptr) *hourAngle = remainder (angle, 360.0);
+    double altitude = asind(sind(site.latitude) * sind(dec) + cosd(site.latitude) * cosd(dec) * cosd(angle));
+    if (site.twilightAngle == TWILIGHT_ANGLE_DAYLIGHT) return altitude - (TWILIGHT_ANGLE_DAYLIGHT) + 0.2666 / r;
+    return altitude - site.twilightAngle;
+}
+
+/* Crossing of the event altitude between two hours with the altitude of opposite signs, by bisection */
+static double referenceCrossing (const SunSite &site, const long day, double from, double to)
+{
+    bool rising = referenceAltitude (site, day, from) < 0.0;
+    for (int i = 0; i < 48; i++)
+    {
+        double middle = (from + to) / 2.0;
+        if ((referenceAltitude (site, day, middle) < 0.0) == rising) from = middle;
+        else to = middle;
+    }
+    return (from + to) / 2.0;
+}
+
+/* Rise and set around the transit nearest to that of Sun::riset, REFERENCE_NO_EVENT if there is none */
+static void referenceEvents (const SunSite &site, const long day, double *rise, double *set)
+{
+    double transit = 12.0 - site.longitude / 15.0, hourAngle;
+    for (int i = 0; i < 5; i++)
+    {
+        referenceAltitude (site, day, transit, &hourAngle);
+        transit -= hourAngle / 15.0;
+    }
+    bool up = referenceAltitude (site, day, transit) > 0.0;
+    *rise = up && referenceAltitude (site, day, transit - 12.0) < 0.0 ? referenceCrossing (site, day, transit - 12.0, transit)
+                                                                        : REFERENCE_NO_EVENT;
+    *set  = up && referenceAltitude (site, day, transit + 12.0) < 0.0 ? referenceCrossing (site, day, transit, transit + 12.0)
+                                                                        : REFERENCE_NO_EVENT;
+}
+
+/* Clear-sky GHI of the Haurwitz model for the reference position at an instant, hour UTC of the day */
+static double referenceGHI (const SunSite &site, const long day, const double hour)
+{
+    double ra, dec, r, siderealTime;
+    referencePosition (2451544.5 + day + hour / 24.0, &ra, &dec, &r, &siderealTime);
+    double angle = siderealTime + site.longitude - ra;
+    double sinAltitude = sind(site.latitude) * sind(dec) + cosd(site.latitude) * cosd(dec) * cosd(angle);
+    return sinAltitude > 0.0 ? 1098.0 * sinAltitude * exp (-0.059 / sinAltitude) : 0.0;
+}
+
+/*
+** Largest difference of referencePosition from Meeus, Astronomical Algorithms, example 25.b (the apparent
+** sun on 1992 October 13.0 TD: right ascension 13h13m30.749s, declination -7d47m01.74s), arc seconds
+*/
+static double referencePositionError ()
+{
+    double ra, dec, r, siderealTime;
+    referencePosition (2448908.5 - referenceDeltaT (1992.78) / 86400.0, &ra, &dec, &r, &siderealTime);
+    double raError = fabs (remainder (ra - (13.0 + 13.0 / 60.0 + 30.749 / 3600.0) * 15.0, 360.0)) * cosd(dec);
+    double decError = fabs (dec + (7.0 + 47.0 / 60.0 + 1.74 / 3600.0));
+    return fmax (raError, decError) * 3600.0;
+}
+
+/*
+** Print the rows of reference.hpp
+*/
+static void bench_reference ()
+{
+    std::vector<SunSite> sites = regressionSites ();
+    for (long day : regressionDays ())
+    {
+        for (const SunSite &site : sites)
+        {
+            double rise, set;
+            referenceEvents (site, day, &rise, &set);
+            printf ("    { %.6f, %.6f },\n", rise, set);
+        }
+    }
+}
+
+/*
+** The limits of the regression suite, for a Release build. The errors are in seconds: against the
+** reference (apart from the mismatches, events which exist in only one of them) and against the scalar
+** path. The cost is relative to the scalar path. The errors against the reference are those of each
+** path at the time of writing, plus a little.
+**
+** The SunWait paths go through the public API: poll(ttime) and the batch poll, bisected to the second at
+** which the state changes, list() and report() for many sites. list() and report() take dates of 2000-2099
+** only; the other rows are left out (NaN arcs), as the twilight angles SunHorizon does not have.
+*/
+enum RegressionPath { PATH_SCALAR, PATH_FLOAT, PATH_NOAA, PATH_EPHEMERIS, PATH_CACHED, PATH_FLEET, PATH_CONTOUR,
+                      PATH_DAYLIGHT, PATH_HORIZON, PATH_POLL, PATH_POLL_BATCH, PATH_LIST, PATH_REPORT, PATH_TRACK,
+                      PATH_EXPOSURE
+                    };
+
+struct RegressionLimit
+{
+    RegressionPath path;
+    const char *name;
+    double maxMedian;
+    double maxError;
+    int    maxMismatches;
+    double maxDeviation;
+    double maxCost;
+};
+
+static const RegressionLimit cRegressionLimits[] =
+{
+    { PATH_SCALAR,     "scalar",    11.0, 1335.0, 6,  0.0,    1.0 },
+    { PATH_FLOAT,      "float",     11.0, 1335.0, 6,  4.5,    1.2 },
+    { PATH_NOAA,       "noaa",      11.5, 1340.0, 6,  50.0,   1.5 },
+    { PATH_EPHEMERIS,  "ephemeris", 11.0, 1335.0, 6,  0.01,   1.0 },
+    { PATH_CACHED,     "cached",    11.0, 1335.0, 6,  4.0,    0.5 },
+    { PATH_FLEET,      "fleet",     11.0, 1335.0, 6,  1.05,   0.6 },
+    { PATH_CONTOUR,    "contour",   11.0, 1335.0, 6,  0.01,   0.3 },
+    { PATH_DAYLIGHT,   "daylight",  11.0, 1335.0, 6,  0.01,   0.5 },
+    { PATH_HORIZON,    "horizon",   11.5, 300.0,  4,  0.01,   0.4 },
+    { PATH_POLL,       "poll",      11.0, 830.0,  22, 1.01,   120.0 },
+    { PATH_POLL_BATCH, "pollbatch", 11.0, 830.0,  22, 1.01,   110.0 },
+    { PATH_LIST,       "list",      11.0, 1270.0, 3,  1.01,   10.0 },
+    { PATH_REPORT,     "report",    11.0, 1270.0, 3,  0.01,   5.0 },
+    { PATH_TRACK,      "track",     1.0,  25.0,   8,  1180.0, 40.0 },
+    { PATH_EXPOSURE,   "exposure",  1.0,  25.0,   6,  1345.0, 80.0 },
+};
+
+/* SunIrradiance: largest difference from referenceGHI, W/m^2, and cost per value relative to the scalar path */
+static const double cRegressionMaxGHIError = 0.2;
+static const double cRegressionMaxGHICost = 0.1;
+
+/* referencePosition: largest difference from Meeus' example, arc seconds (the full nutation is left out) */
+static const double cRegressionMaxReferenceError = 1.0;
+
+static bool regressionEvent (const SunArc &arc, const bool isSet, double *hour)
+{
+    if (arc.diurnalArc <= 0.0 || arc.diurnalArc >= 24.0) return false;
+    *hour = isSet ? arc.southHourUTC + arc.diurnalArc / 2.0 : arc.southHourUTC - arc.diurnalArc / 2.0;
+    return true;
+}
+
+/*
+** The arc of the events of an instant-based path, hours UTC of the day: the last rise before the transit
+** estimated from the longitude and the first set after it, or polar day or night from the state at that
+** transit. Events are (hour, rise) in time order.
+*/
+static SunArc regressionArc (const double transit, const bool upAtTransit, const std::vector<std::pair<double, bool>> &events)
+{
+    double rise = REFERENCE_NO_EVENT, set = REFERENCE_NO_EVENT;
+    for (const std::pair<double, bool> &event : events)
+    {
+        if (event.second && event.first > transit - 12.5 && event.first < transit + 0.5) rise = event.first;
+        if (!event.second && event.first > transit - 0.5 && event.first < transit + 12.5 && set == REFERENCE_NO_EVENT)
+            set = event.first;
+    }
+    if (rise != REFERENCE_NO_EVENT && set != REFERENCE_NO_EVENT && set > rise) return SunArc (set - rise, (rise + set) / 2.0);
+    return SunArc (upAtTransit && rise == REFERENCE_NO_EVENT && set == REFERENCE_NO_EVENT ? 24.0 : 0.0, transit);
+}
+
+/*
+** Compare the arcs of one path with the reference and the scalar path, print and check against the limits.
+** Rows the path does not cover (SunHorizon only has the daylight angle) have a NaN arc.
+*/
+static bool regressionCheck (const RegressionLimit &limit, const std::vector<SunArc> &arcs, const std::vector<SunArc> &scalar,
+                             const double nsPerOp, const double scalarNsPerOp)
+{
+    static const double cBins[] = { 1.0, 5.0, 15.0, 30.0, 60.0, 120.0, 300.0 };
+    const int bins = sizeof (cBins) / sizeof (cBins[0]);
+    int histogram[bins + 1] = { 0 };
+    int mismatches = 0;
+    double maxError = 0.0, maxDeviation = 0.0;
+    std::vector<double> errors;
+
+    for (size_t row = 0; row < arcs.size (); row++)
+    {
+        if (std::isnan (arcs[row].diurnalArc)) continue;
+        for (int isSet = 0; isSet < 2; isSet++)
+        {
+            double hour, scalarHour;
+            bool exists = regressionEvent (arcs[row], isSet, &hour);
+            double reference = cReferenceEvents[row][isSet];
+            if (exists != (reference != REFERENCE_NO_EVENT)) mismatches++;
+            else if (exists)
+            {
+                double error = fabs (hour - reference) * 3600.0;
+                int bin = 0;
+                while (bin < bins && error >= cBins[bin]) bin++;
+                histogram[bin]++;
+                errors.push_back (error);
+                maxError = fmax (maxError, error);
+            }
+            if (exists && regressionEvent (scalar[row], isSet, &scalarHour))
+                maxDeviation = fmax (maxDeviation, fabs (hour - scalarHour) * 3600.0);
+        }
+    }
+    std::sort (errors.begin (), errors.end ());
+    double median = errors.empty () ? 0.0 : errors[errors.size () / 2];
+
+    bool passed = median <= limit.maxMedian && maxError <= limit.maxError && mismatches <= limit.maxMismatches && maxDeviation <= limit.maxDeviation
+                  && nsPerOp <= limit.maxCost * scalarNsPerOp;
+    printf ("regression: %-9s %7.1f ns/op, error median %5.1f s max %6.1f s, %d mismatches, %.3f s from scalar: %s\n",
+            limit.name, nsPerOp, median, maxError, mismatches, maxDeviation, passed ? "ok" : "FAILED");
+    printf ("regression: %-9s", "");
+    for (int bin = 0; bin < bins; bin++) printf (" <%.0fs %4d", cBins[bin], histogram[bin]);
+    printf (" more %4d\n", histogram[bins]);
+    return passed;
+}
+
+/*
+** The arc of SunWait::poll(ttime) around the transit estimated from the longitude, hours UTC of the day: the
+** first second of each new state within 12 hours before and after the transit, by bisection
+*/
+static SunArc pollArc (SunWait &sw, const time_t midnight, const double transit, std::vector<std::pair<double, bool>> &events)
+{
+    const time_t middle = midnight + (time_t) lround (transit * 3600.0);
+    const time_t bounds[3] = { middle - 12 * 3600, middle, middle + 12 * 3600 };
+    int states[3];
+    for (int i = 0; i < 3; i++) states[i] = sw.poll (bounds[i]);
+
+    events.clear ();
+    for (int i = 0; i < 2; i++)
+    {
+        if (states[i] == states[i + 1]) continue;
+        time_t from = bounds[i], to = bounds[i + 1];
+        while (to - from > 1)
+        {
+            time_t t = from + (to - from) / 2;
+            if (sw.poll (t) == states[i + 1]) to = t;
+            else from = t;
+        }
+        events.push_back (std::make_pair ((to - (double) midnight) / 3600.0, states[i + 1] == EXIT_DAY));
+    }
+    return regressionArc (transit, states[1] == EXIT_DAY, events);
+}
+
+/*
+** As pollArc for all days of each site, with the batch poll: each call takes one step of the bisection of
+** every interval of the site, in time order
+*/
+static void pollBatchArcs (const std::vector<SunSite> &sites, const std::vector<long> &days, SunArc *arcs)
+{
+    const size_t n = days.size ();
+    std::vector<time_t> bounds (3 * n), from (2 * n), to (2 * n), middles (2 * n);
+    std::vector<unsigned char> states (3 * n), isDay (2 * n);
+    std::vector<std::pair<double, bool>> events;
+    for (size_t s = 0; s < sites.size (); s++)
+    {
+        SunWait sw (sites[s].latitude, sites[s].longitude, sites[s].twilightAngle);
+        const double transit = 12.0 - sites[s].longitude / 15.0;
+        for (size_t d = 0; d < n; d++)
+        {
+            const time_t middle = (time_t) (days[d] + (DAYS_TO_2000)) * 86400 + (time_t) lround (transit * 3600.0);
+            for (int i = 0; i < 3; i++) bounds[3 * d + i] = middle + (i - 1) * 12 * 3600;
+        }
+        sw.poll (bounds.data (), 3 * n, states.data ());
+        for (size_t d = 0; d < n; d++)
+            for (int i = 0; i < 2; i++)
+            {
+                from[2 * d + i] = bounds[3 * d + i];
+                to[2 * d + i] = bounds[3 * d + i + 1];
+            }
+
+        // 12 hours take 16 halvings down to one second
+        for (int step = 0; step < 16; step++)
+        {
+            for (size_t i = 0; i < 2 * n; i++) middles[i] = from[i] + (to[i] - from[i]) / 2;
+            sw.poll (middles.data (), 2 * n, isDay.data ());
+            for (size_t i = 0; i < 2 * n; i++)
+            {
+                if (isDay[i] == states[3 * (i / 2) + i % 2 + 1]) to[i] = middles[i];
+                else from[i] = middles[i];
+            }
+        }
+
+        for (size_t d = 0; d < n; d++)
+        {
+            const time_t midnight = (time_t) (days[d] + (DAYS_TO_2000)) * 86400;
+            events.clear ();
+            for (int i = 0; i < 2; i++)
+                if (states[3 * d + i] != states[3 * d + i + 1])
+                    events.push_back (std::make_pair ((to[2 * d + i] - (double) midnight) / 3600.0, states[3 * d + i + 1] != 0));
+            arcs[d * sites.size () + s] = regressionArc (transit, states[3 * d + 1] != 0, events);
+        }
+    }
+}
+
+/*
+** The arc of the rise and set of SunWait::list for one day, hours UTC of the day
+*/
+static SunArc listArc (SunWait &sw, const time_t midnight, const struct tm &date, const double transit)
+{
+    std::pair<std::vector<time_t>, std::vector<time_t>> listed = sw.list (1, date.tm_year - 100, date.tm_mon + 1, date.tm_mday);
+    const time_t rise = listed.first[0], set = listed.second[0];
+    if (rise == POLAR_DAY) return SunArc (24.0, transit);
+    if (rise == POLAR_NIGHT) return SunArc (0.0, transit);
+    return SunArc ((double) (set - rise) / 3600.0, ((rise - midnight) + (set - midnight)) / 7200.0);
+}
+
+/*
+** Run every path over the grid and check it against the reference
+*/
+static void bench_regression ()
+{
+    const int repeats = 20; // After one more untimed pass, which also fills the cache
+    std::vector<SunSite> sites = regressionSites ();
+    std::vector<long> days = regressionDays ();
+    const size_t rows = sites.size () * days.size ();
+    if (sizeof (cReferenceEvents) / sizeof (cReferenceEvents[0]) != rows)
+    {
+        printf ("Error: reference.hpp does not match the grid of the regression suite.\n");
+        benchFailed = true;
+        return;
+    }
+
+#if defined __linux__ || defined __APPLE__
+    // list() and report() work out the UTC date through local time, with the daylight saving time of the
+    // current time (see SunWait::targetTime): run in UTC, so the rows are those of the dates asked for
+    const char *zone = getenv ("TZ");
+    const std::string savedZone = zone != nullptr ? zone : "";
+    setenv ("TZ", "UTC", 1);
+    tzset ();
+#endif
+
+    ChebyshevEphemeris ephemeris;
+    SunCache cache;
+    SunFleet fleet (sites);
+    std::vector<SunContour> contours;
+    for (long day : days) contours.push_back (SunContour (sites, (unsigned long) day, 1));
+    SunDaylight daylight (sites);
+    std::vector<SunDaylightStats> stats;
+    std::vector<SunHorizon> horizons;
+    std::vector<SunFacade> facades;
+    for (const SunSite &site : sites)
+    {
+        horizons.push_back (SunHorizon (site.latitude, site.longitude));
+        double minAltitude = site.twilightAngle == TWILIGHT_ANGLE_DAYLIGHT ? site.twilightAngle - 0.2666 : site.twilightAngle;
+        facades.push_back (SunFacade (site.latitude, site.longitude, 0.0, 0.0, minAltitude));
+    }
+    SunExposure exposure (facades);
+    std::vector<SunFacadeEvent> facadeEvents;
+    std::vector<unsigned char> exposedAtStart (sites.size ());
+    std::vector<SunTrackEvent> trackEvents;
+    std::vector<std::pair<double, bool>> events;
+    SunWait reporter;
+    reporter.utc = true;
+    std::vector<SunReport> reports (sites.size ());
+
+    const size_t paths = sizeof (cRegressionLimits) / sizeof (cRegressionLimits[0]);
+    std::vector<std::vector<SunArc>> arcs (paths, std::vector<SunArc> (rows, SunArc (0.0, 0.0)));
+    double nsPerOp[paths];
+    for (size_t path = 0; path < paths; path++)
+    {
+        const RegressionPath kind = cRegressionLimits[path].path;
+        Clock::time_point start = Clock::now ();
+        for (int repeat = -1; repeat < repeats; repeat++)
+        {
+            if (repeat == 0) start = Clock::now ();
+            SunArc *out = arcs[path].data ();
+            if (kind == PATH_POLL_BATCH)
+            {
+                pollBatchArcs (sites, days, out);
+                continue;
+            }
+            for (size_t d = 0; d < days.size (); d++)
+            {
+                unsigned long day = (unsigned long) days[d];
+                const time_t midnight = (time_t) (days[d] + (DAYS_TO_2000)) * 86400;
+                struct tm date;
+                gmtime_r (&midnight, &date);
+                const bool listed = date.tm_year >= 100 && date.tm_year < 200;  // list() and report() take 2000-2099
+                if (kind == PATH_FLEET)
+                {
+                    fleet.riset (day, out);
+                    out += sites.size ();
+                    continue;
+                }
+                if (kind == PATH_REPORT)
+                {
+                    if (listed)
+                        reporter.report (sites.data (), sites.size (), reports.data (), date.tm_year - 100, date.tm_mon + 1,
+                                         date.tm_mday, midnight);
+                    for (size_t s = 0; s < sites.size (); s++) *out++ = listed ? reports[s].target : SunArc (NAN, NAN);
+                    continue;
+                }
+                if (kind == PATH_DAYLIGHT)
+                {
+                    // The arcs at the four angles add up from the daylight and twilight bands; the south hour is
+                    // that of Sun::riset, which SunDaylight does not report
+                    daylight.aggregate (day, 1, &stats, nullptr);
+                    for (size_t s = 0; s < sites.size (); s++)
+                    {
+                        const SunDaylightStats &today = stats[s];
+                        const double bands[4] = { today.totalDaylight, today.totalDaylight + today.civilTwilight,
+                                                  today.totalDaylight + today.civilTwilight + today.nauticalTwilight,
+                                                  24.0 - today.night
+                                                };
+                        int band = 0;
+                        while (band < 3 && cRegressionAngles[band] != sites[s].twilightAngle) band++;
+                        *out++ = SunArc (bands[band], arcs[PATH_SCALAR][d * sites.size () + s].southHourUTC);
+                    }
+                    continue;
+                }
+                if (kind == PATH_EXPOSURE)
+                {
+                    // A sector of all azimuths above the event altitude (the upper limb at one astronomical unit)
+                    facadeEvents.clear ();
+                    exposure.events (midnight - 12 * 3600, midnight + 36 * 3600, facadeEvents, exposedAtStart.data ());
+                    for (size_t s = 0; s < sites.size (); s++)
+                    {
+                        const double transit = 12.0 - sites[s].longitude / 15.0;
+                        bool up = exposedAtStart[s] != 0;
+                        events.clear ();
+                        for (const SunFacadeEvent &event : facadeEvents)
+                        {
+                            if (event.facade != s) continue;
+                            double hour = (event.time - (double) midnight) / 3600.0;
+                            if (hour < transit) up = event.isEntry;
+                            events.push_back (std::make_pair (hour, event.isEntry));
+                        }
+                        *out++ = regressionArc (transit, up, events);
+                    }
+                    continue;
+                }
+                for (size_t s = 0; s < sites.size (); s++)
+                {
+                    const SunSite &site = sites[s];
+                    switch (kind)
+                    {
+                        case PATH_SCALAR:
+                            *out++ = Sun(site.longitude, site.latitude, site.twilightAngle).riset (day);
+                            break;
+                        case PATH_FLOAT:
+                            *out++ = SunFloat((float) site.longitude, (float) site.latitude, (float) site.twilightAngle).riset (day);
+                            break;
+                        case PATH_NOAA:
+                            *out++ = SunNOAA(site.longitude, site.latitude, site.twilightAngle).riset (day);
+                            break;
+                        case PATH_EPHEMERIS:
+                        {
+                            Sun sun(site.longitude, site.latitude, site.twilightAngle);
+                            sun.ephemeris = &ephemeris;
+                            *out++ = sun.riset (day);
+                            break;
+                        }
+                        case PATH_CACHED:
+                            *out++ = cache.riset (site.latitude, site.longitude, site.twilightAngle, day);
+                            break;
+                        case PATH_HORIZON:
+                        {
+                            if (site.twilightAngle != TWILIGHT_ANGLE_DAYLIGHT)
+                            {
+                                *out++ = SunArc (NAN, NAN);
+                                break;
+                            }
+                            SunHorizonDay horizon = horizons[s].riset (day);
+                            *out++ = SunArc (horizon.setHourUTC - horizon.riseHourUTC,
+                                             (horizon.riseHourUTC + horizon.setHourUTC) / 2.0);
+                            break;
+                        }
+                        case PATH_POLL:
+                        {
+                            SunWait sw (site.latitude, site.longitude, site.twilightAngle);
+                            *out++ = pollArc (sw, midnight, 12.0 - site.longitude / 15.0, events);
+                            break;
+                        }
+                        case PATH_LIST:
+                        {
+                            if (!listed)
+                            {
+                                *out++ = SunArc (NAN, NAN);
+                                break;
+                            }
+                            SunWait sw (site.latitude, site.longitude, site.twilightAngle);
+                            sw.utc = true;
+                            *out++ = listArc (sw, midnight, date, 12.0 - site.longitude / 15.0);
+                            break;
+                        }
+                        case PATH_TRACK:
+                        {
+                            // An observer standing still, hourly points around the transit
+                            const int points = 27;
+                            const double transit = 12.0 - site.longitude / 15.0;
+                            time_t times[points];
+                            double latitudes[points], longitudes[points];
+                            unsigned char isDay[points];
+                            for (int i = 0; i < points; i++)
+                            {
+                                times[i] = midnight + (time_t) lround ((transit + i - points / 2) * 3600.0);
+                                latitudes[i] = site.latitude;
+                                longitudes[i] = site.longitude;
+                            }
+                            trackEvents.clear ();
+                            SunTrack (site.twilightAngle).events (times, latitudes, longitudes, points, trackEvents, isDay);
+                            events.clear ();
+                            for (const SunTrackEvent &event : trackEvents)
+                                events.push_back (std::make_pair ((event.time - (double) midnight) / 3600.0, event.isRise));
+                            *out++ = regressionArc (transit, isDay[points / 2] != 0, events);
+                            break;
+                        }
+                        default: // PATH_CONTOUR (PATH_FLEET, PATH_REPORT, PATH_DAYLIGHT and PATH_EXPOSURE are done above)
+                            *out++ = contours[d].riset (s, day, site.twilightAngle);
+                    }
+                }
+            }
+        }
+        nsPerOp[path] = seconds_since (start) / ((double) rows * repeats) * 1e9;
+    }
+
+    bool passed = true;
+    for (size_t path = 0; path < paths; path++)
+        passed = regressionCheck (cRegressionLimits[path], arcs[path], arcs[PATH_SCALAR], nsPerOp[path], nsPerOp[PATH_SCALAR]) && passed;
+
+    // SunIrradiance: hourly GHI of the Haurwitz model (which needs no plant terms) against that of the reference
+    std::vector<SunPlant> plants;
+    for (const SunSite &site : sites) plants.push_back (SunPlant (site.latitude, site.longitude));
+    SunIrradiance irradiance (plants, SUN_CLEAR_SKY_HAURWITZ);
+    const int slots = 24;
+    std::vector<float> ghi ((size_t) slots * sites.size () * days.size ());
+    Clock::time_point start = Clock::now ();
+    for (int repeat = -1; repeat < repeats; repeat++)
+    {
+        if (repeat == 0) start = Clock::now ();
+        for (size_t d = 0; d < days.size (); d++)
+            irradiance.ghi ((time_t) (days[d] + (DAYS_TO_2000)) * 86400, 3600, slots, &ghi[d * slots * sites.size ()]);
+    }
+    double nsPerValue = seconds_since (start) / ((double) ghi.size () * repeats) * 1e9;
+    double maxGHIError = 0.0;
+    for (size_t d = 0; d < days.size (); d++)
+        for (int slot = 0; slot < slots; slot++)
+            for (size_t s = 0; s < sites.size (); s++)
+            {
+                double error = fabs (ghi[(d * slots + slot) * sites.size () + s] - referenceGHI (sites[s], days[d], slot));
+                maxGHIError = fmax (maxGHIError, error);
+            }
+    bool ghiPassed = maxGHIError <= cRegressionMaxGHIError && nsPerValue <= cRegressionMaxGHICost * nsPerOp[PATH_SCALAR];
+    printf ("regression: %-9s %7.1f ns/value, GHI within %.2f W/m^2 of the reference: %s\n", "irradiance", nsPerValue,
+            maxGHIError, ghiPassed ? "ok" : "FAILED");
+    passed = passed && ghiPassed;
+
+    // The reference itself, against the example of its source
+    double positionError = referencePositionError ();
+    bool referencePassed = positionError <= cRegressionMaxReferenceError;
+    printf ("regression: reference position within %.2f arcsec of Meeus example 25.b: %s\n", positionError,
+            referencePassed ? "ok" : "FAILED");
+    passed = passed && referencePassed;
+    printf ("regression: %zu sites x %zu days, 1900-2100: %s\n", sites.size (), days.size (), passed ? "passed" : "FAILED");
+    if (!passed) benchFailed = true;
+
+#if defined __linux__ || defined __APPLE__
+    if (zone != nullptr) setenv ("TZ", savedZone.c_str (), 1);
+    else unsetenv ("TZ");
+    tzset ();
+#endif
+}
+
+#if defined __linux__ || defined __APPLE__
+/*
+** Day/night state: SunWait::poll against a seqlock snapshot of the published state
+*/
+static void bench_state ()
+{
+    const int sites = 1000;
+    const int count = 10000000;
+    std::vector<SunSite> siteList;
+    srand (3);
+    for (int i = 0; i < sites; i++)
+        siteList.push_back (SunSite ((rand () % 17000) / 100.0 - 85.0, (rand () % 36000) / 100.0 - 180.0));
+
+    Clock::time_point start = Clock::now ();
+    SunStatePublisher publisher (siteList);
+    if (!publisher.create ("/sunwait-bench")) return;
+    report ("state: publish (per site)", seconds_since (start), sites);
+
+    SunStateReader reader;
+    if (!reader.open ("/sunwait-bench")) return;
+
+    long sum = 0;
+    start = Clock::now ();
+    for (int i = 0; i < sites; i++)
+    {
+        SunWait sw (siteList[i].latitude, siteList[i].longitude);
+        sum += sw.poll ();
+    }
+    report ("state: SunWait::poll", seconds_since (start), sites);
+
+    start = Clock::now ();
+    for (int i = 0; i < count; i++) sum += reader.poll (i % sites);
+    report ("state: SunStateReader::poll", seconds_since (start), count);
+
+    if (sum == 0) printf ("state: no sites\n");
+}
+#endif
+
+struct Benchmark
+{
+    const char *name;
+    void (*run) ();
+};
+
+static const Benchmark cBenchmarks[] =
+{
+    { "coordinates", bench_coordinates },
+    { "formatter",   bench_formatter },
+    { "report",      bench_report },
+    { "sweep",       bench_sweep },
+    { "cancel",      bench_cancel },
+    { "simulate",    bench_simulate },
+    { "rules",       bench_rules },
+    { "track",       bench_track },
+    { "gradient",    bench_gradient },
+    { "contour",     bench_contour },
+    { "daylight",    bench_daylight },
+    { "irradiance",  bench_irradiance },
+    { "facade",      bench_facade },
+    { "horizon",     bench_horizon },
+    { "backends",    bench_backends },
+    { "regression",  bench_regression },
+    { "reference",   bench_reference },
+#if defined __linux__ || defined __APPLE__
+    { "state",       bench_state },
+#endif
+};
+
+int main (int argc, char *argv[])
+{
+    int run = 0;
+    for (const Benchmark &benchmark : cBenchmarks)
+    {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc; i++)
+            if (!strcmp (argv[i], benchmark.name)) selected = true;
+        if (!selected) continue;
+        benchmark.run ();
+        run++;
+    }
+    if (run == 0)
+    {
+        printf ("Usage: bench [name ...]\nBenchmarks:");
+        for (const Benchmark &benchmark : cBenchmarks) printf (" %s", benchmark.name);
+        printf ("\n");
+        return EXIT_ERROR;
+    }
+    return benchFailed ? EXIT_ERROR : EXIT_OK;
+}
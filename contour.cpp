@@ -0,0 +1,163 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#include <math.h>
+
+#include "contour.hpp"
+#include "sun.hpp"
+#include "ephemeris.hpp"
+
+/* The sun's position for a day as Sun::riset takes it, and its hour angle at Greenwich at 00:00 UTC, degrees */
+static void sunOfDay (const unsigned long daysSince2000, const ChebyshevEphemeris *ephemeris,
+                      double *sinDec, double *cosDec, double *hourAngle, double *sradius)
+{
+    double sra, sdec, sr;
+    double day = (double) (long) daysSince2000 + 1.5; // Noon UTC of the day (days before 2000 too), as in Sun::riset
+    if (ephemeris != nullptr && ephemeris->covers (day))
+        ephemeris->sun_RA_dec (day, &sra, &sdec, &sr);
+    else
+        Sun::sun_RA_dec (day, &sra, &sdec, &sr);
+
+    *sinDec = sind(sdec);
+    *cosDec = cosd(sdec);
+    *hourAngle = Sun::GMST0 (day) + 180.0 - sra;
+    *sradius = 0.2666 / sr;
+}
+
+/* Hour UTC the sun is south of a longitude, in the range of Sun::riset */
+static double southHour (const double hourAngle, const double longitude)
+{
+    double angle = hourAngle + longitude;
+    angle -= 360.0 * ceil ((angle - 180.0) / 360.0);   // -180 < angle <= 180
+    return 12.0 - angle / 15.0;
+}
+
+SunContour::SunContour(const std::vector<SunSite> &siteSet, const unsigned long first, const int count,
+                       const ChebyshevEphemeris *eph)
+    : sites{siteSet}, firstDay{first}, days{count > 0 ? count : 0}, ephemeris{eph}
+{
+    // The site terms are shared by all days
+    std::vector<double> sinLatitude (sites.size ()), cosLatitude (sites.size ());
+    for (size_t s = 0; s < sites.size (); s++)
+    {
+        sinLatitude[s] = sind(sites[s].latitude);
+        cosLatitude[s] = cosd(sites[s].latitude);
+    }
+
+    curves.resize ((size_t) days * sites.size ());
+    sradius.resize (days);
+    for (int day = 0; day < days; day++)
+    {
+        double sinDec, cosDec, hourAngle;
+        sunOfDay (firstDay + day, ephemeris, &sinDec, &cosDec, &hourAngle, &sradius[day]);
+
+        Curve *row = &curves[(size_t) day * sites.size ()];
+        for (size_t s = 0; s < sites.size (); s++)
+        {
+            row[s].southHour = southHour (hourAngle, sites[s].longitude);
+            row[s].offset = sinLatitude[s] * sinDec;
+            row[s].amplitude = cosLatitude[s] * cosDec;
+        }
+    }
+}
+
+SunContour::Curve SunContour::curve (const size_t site, const unsigned long daysSince2000) const
+{
+    if (covers (daysSince2000)) return curves[(daysSince2000 - firstDay) * sites.size () + site];
+
+    double sinDec, cosDec, hourAngle, radius;
+    sunOfDay (daysSince2000, ephemeris, &sinDec, &cosDec, &hourAngle, &radius);
+    Curve result;
+    result.southHour = southHour (hourAngle, sites[site].longitude);
+    result.offset = sind(sites[site].latitude) * sinDec;
+    result.amplitude = cosd(sites[site].latitude) * cosDec;
+    return result;
+}
+
+double SunContour::sinAltitude (const unsigned long daysSince2000, const double angle) const
+{
+    if (angle != TWILIGHT_ANGLE_DAYLIGHT) return sind(angle);
+
+    // Upper limb, as in Sun::riset
+    double radius;
+    if (covers (daysSince2000))
+        radius = sradius[daysSince2000 - firstDay];
+    else
+    {
+        double sinDec, cosDec, hourAngle;
+        sunOfDay (daysSince2000, ephemeris, &sinDec, &cosDec, &hourAngle, &radius);
+    }
+    return sind(angle - radius);
+}
+
+SunArc SunContour::arc (const Curve &curve, const double sinAltitude)
+{
+    // Below the daily minimum the sun is always above the altitude, above the maximum never
+    double cost = (sinAltitude - curve.offset) / curve.amplitude;
+    if (cost >= 1.0) return SunArc(0.0, curve.southHour);   // Polar Night
+    if (cost <= -1.0) return SunArc(24.0, curve.southHour); // Midnight Sun
+    return SunArc(2.0 * acosd(cost) / 15.0, curve.southHour);
+}
+
+SunArc SunContour::riset (const size_t site, const unsigned long daysSince2000, const double angle) const
+{
+    if (!covers (daysSince2000))
+    {
+        Sun sun(sites[site].longitude, sites[site].latitude, angle);
+        sun.ephemeris = ephemeris;
+        return sun.riset (daysSince2000);
+    }
+    return arc (curves[(daysSince2000 - firstDay) * sites.size () + site], sinAltitude (daysSince2000, angle));
+}
+
+void SunContour::riset (const unsigned long daysSince2000, const double angle, SunArc *arcs) const
+{
+    if (!covers (daysSince2000))
+    {
+        for (size_t s = 0; s < sites.size (); s++) arcs[s] = riset (s, daysSince2000, angle);
+        return;
+    }
+
+    // One altitude for all sites
+    const double sine = sinAltitude (daysSince2000, angle);
+    const Curve *row = &curves[(daysSince2000 - firstDay) * sites.size ()];
+    for (size_t s = 0; s < sites.size (); s++) arcs[s] = arc (row[s], sine);
+}
+
+double SunContour::maxAltitude (const size_t site, const unsigned long daysSince2000) const
+{
+    Curve c = curve (site, daysSince2000);
+    return asind(fmin (c.offset + c.amplitude, 1.0));
+}
+
+double SunContour::minAltitude (const size_t site, const unsigned long daysSince2000) const
+{
+    Curve c = curve (site, daysSince2000);
+    return asind(fmax (c.offset - c.amplitude, -1.0));
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include "libsunwait.hpp"
+#include "sunarc.hpp"
+
+/**
+ * @brief Sun altitude curves of many sites over a range of days, for queries at any twilight angle
+ *
+ * Sun::riset takes the sun's declination for the whole day, so the altitude h over the hour angle H is the curve
+ *
+ *     sin h = sin lat sin dec + cos lat cos dec cos H
+ *
+ * which is fixed by the south hour and the two coefficients. The table holds them per site and day, and
+ * rise and set for an altitude are the exact inverse of the curve: one sine and one arc cosine, with no
+ * interpolation error. The daily minimum and maximum altitude follow from the coefficients as well. Building
+ * the table computes the sun's position once per day for all sites, which is most of the work of Sun::riset.
+ *
+ * As with Sun::riset, the angle TWILIGHT_ANGLE_DAYLIGHT is taken for the upper limb of the sun, any other
+ * angle for its centre. Days outside the table are computed with Sun::riset.
+ */
+class SunContour
+{
+    public:
+    /**
+     * @brief Build the table
+     *
+     * @param sites Site set (only the positions are used)
+     * @param firstDay First day of the table, days since 2000
+     * @param days Number of days
+     * @param ephemeris Optional precomputed ephemeris, see SunWait::ephemeris
+     */
+        SunContour(const std::vector<SunSite> &sites, const unsigned long firstDay, const int days,
+                   const ChebyshevEphemeris *ephemeris = nullptr);
+
+    /**
+     * @brief The sun arc of one site for any altitude (see Sun::riset)
+     *
+     * @param site Index in the site set
+     * @param daysSince2000 Day of the request
+     * @param angle Altitude in degrees, the twilight angle
+     */
+        SunArc riset (const size_t site, const unsigned long daysSince2000, const double angle) const;
+
+    /**
+     * @brief The sun arcs of all sites for any altitude
+     *
+     * @param daysSince2000 Day of the request
+     * @param angle Altitude in degrees, the twilight angle
+     * @param arcs Output, one arc per site in the order of the site set
+     */
+        void riset (const unsigned long daysSince2000, const double angle, SunArc *arcs) const;
+
+    /// Highest altitude of the sun's centre on the day, degrees
+        double maxAltitude (const size_t site, const unsigned long daysSince2000) const;
+
+    /// Lowest altitude of the sun's centre on the day, degrees
+        double minAltitude (const size_t site, const unsigned long daysSince2000) const;
+
+    /// true if the day is in the table
+        bool covers (const unsigned long daysSince2000) const
+        {
+            return daysSince2000 - firstDay < (unsigned long) days; // Also for days before 2000 (two's complement)
+        }
+
+    private:
+        struct Curve
+        {
+            double southHour;
+            double offset;       // sin lat sin dec
+            double amplitude;    // cos lat cos dec
+        };
+
+        Curve curve (const size_t site, const unsigned long daysSince2000) const;
+        static SunArc arc (const Curve &curve, const double sinAltitude);
+        double sinAltitude (const unsigned long daysSince2000, const double angle) const;
+
+        std::vector<SunSite> sites;
+        unsigned long firstDay;
+        int days;
+        std::vector<Curve>  curves;     // day-major: day * sites + site
+        std::vector<double> sradius;    // the sun's apparent radius per day, degrees
+        const ChebyshevEphemeris *ephemeris;
+};
@@ -0,0 +1,249 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <string.h>
+
+#include "coordinate.hpp"
+
+/* Powers of ten for placing the decimal point, instead of pow() */
+static const double cPowersOfTen[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+    1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18
+};
+static const int cMaxDigits = 18;
+
+/*
+** Kinds of separator after a number: which component it closes
+*/
+typedef enum
+{
+    SEPARATOR_NONE
+    , SEPARATOR_DEGREE
+    , SEPARATOR_MINUTE
+    , SEPARATOR_SECOND
+    , SEPARATOR_NEUTRAL   // colon or blank: the next component in order
+} Separator;
+
+inline bool isBlank (const char c)
+{
+    return c == ' ' || c == '\t';
+}
+
+/*
+** Length of the separator at p (0 if none) and its kind
+*/
+inline size_t separatorAt (const char *p, const char *end, Separator *kind)
+{
+    unsigned char c = (unsigned char) *p;
+    if (c == ':')
+    {
+        *kind = SEPARATOR_NEUTRAL;
+        return 1;
+    }
+    if (c == '\'')
+    {
+        // Two apostrophes are used for seconds, too
+        if (p + 1 < end && p[1] == '\'')
+        {
+            *kind = SEPARATOR_SECOND;
+            return 2;
+        }
+        *kind = SEPARATOR_MINUTE;
+        return 1;
+    }
+    if (c == '"')
+    {
+        *kind = SEPARATOR_SECOND;
+        return 1;
+    }
+    if (c == 0xC2 && p + 1 < end && ((unsigned char) p[1] == 0xB0 || (unsigned char) p[1] == 0xBA)) // ° and º
+    {
+        *kind = SEPARATOR_DEGREE;
+        return 2;
+    }
+    if (c == 0xE2 && p + 2 < end && (unsigned char) p[1] == 0x80)
+    {
+        if ((unsigned char) p[2] == 0xB2) // ′
+        {
+            *kind = SEPARATOR_MINUTE;
+            return 3;
+        }
+        if ((unsigned char) p[2] == 0xB3) // ″
+        {
+            *kind = SEPARATOR_SECOND;
+            return 3;
+        }
+    }
+    *kind = SEPARATOR_NONE;
+    return 0;
+}
+
+/*
+** Hemisphere letter at p: sets the axis and the sign, returns false if none
+*/
+inline bool hemisphereAt (const char c, CoordinateAxis *axis, int *sign)
+{
+    switch (c)
+    {
+        case 'N': case 'n': *axis = COORDINATE_LATITUDE;  *sign =  1; return true;
+        case 'S': case 's': *axis = COORDINATE_LATITUDE;  *sign = -1; return true;
+        case 'E': case 'e': *axis = COORDINATE_LONGITUDE; *sign =  1; return true;
+        case 'W': case 'w': *axis = COORDINATE_LONGITUDE; *sign = -1; return true;
+        default: return false;
+    }
+}
+
+inline CoordinateParse fail (const size_t position)
+{
+    CoordinateParse result;
+    result.value = 0.0;
+    result.axis = COORDINATE_ANY;
+    result.ok = false;
+    result.errorPosition = position;
+    return result;
+}
+
+CoordinateParse parseCoordinate (const char *text, const size_t length)
+{
+    const char *p = text;
+    const char *end = text + length;
+    CoordinateAxis axis = COORDINATE_ANY;
+    int  sign = 1;
+    bool hasSign = false;
+
+    while (p < end && isBlank (*p)) p++;
+
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        sign = *p == '-' ? -1 : 1;
+        hasSign = true;
+        p++;
+    }
+    else if (p < end && hemisphereAt (*p, &axis, &sign))
+    {
+        p++;
+        while (p < end && isBlank (*p)) p++;
+    }
+
+    // Up to three components: degrees, minutes, seconds
+    const char *numbersStart = p;
+    double components[3] = { 0.0, 0.0, 0.0 };
+    int    count = 0;
+    bool   hadFraction = false;
+
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        if (count == 3 || hadFraction) return fail (p - text);
+
+        const char *numberStart = p;
+        unsigned long long mantissa = 0;
+        int digits = 0;
+        int fractionDigits = 0;
+        for (; p < end && *p >= '0' && *p <= '9'; p++)
+        {
+            if (digits < cMaxDigits)
+            {
+                mantissa = mantissa * 10 + (unsigned) (*p - '0');
+                digits++;
+            }
+            else
+                return fail (p - text);
+        }
+        if (p < end && (*p == '.' || *p == ','))
+        {
+            p++;
+            hadFraction = true;
+            for (; p < end && *p >= '0' && *p <= '9'; p++)
+            {
+                // Digits beyond the precision of a double are dropped
+                if (digits < cMaxDigits)
+                {
+                    mantissa = mantissa * 10 + (unsigned) (*p - '0');
+                    digits++;
+                    fractionDigits++;
+                }
+            }
+        }
+        double value = (double) mantissa / cPowersOfTen[fractionDigits];
+
+        // The separator says which component this was; blanks and colons take the next one
+        while (p < end && isBlank (*p)) p++;
+        Separator kind = SEPARATOR_NONE;
+        size_t separatorLength = p < end ? separatorAt (p, end, &kind) : 0;
+        int component = count;
+        if (kind == SEPARATOR_DEGREE) component = 0;
+        else if (kind == SEPARATOR_MINUTE) component = 1;
+        else if (kind == SEPARATOR_SECOND) component = 2;
+        if (component < count) return fail (p - text);          // Out of order, e.g. 12'30°
+        if (component > 0 && value >= 60.0) return fail (numberStart - text);
+
+        components[component] = value;
+        count = component + 1;
+        p += separatorLength;
+        while (p < end && isBlank (*p)) p++;
+    }
+    if (count == 0) return fail (p - text);
+
+    if (p < end && axis == COORDINATE_ANY && hemisphereAt (*p, &axis, &sign))
+    {
+        if (hasSign) return fail (p - text);
+        p++;
+        while (p < end && isBlank (*p)) p++;
+    }
+    if (p != end) return fail (p - text);
+
+    CoordinateParse result;
+    result.value = sign * (components[0] + components[1] / 60.0 + components[2] / 3600.0);
+    result.axis = axis;
+    result.ok = true;
+    result.errorPosition = 0;
+
+    double limit = axis == COORDINATE_LATITUDE ? 90.0 : 360.0;
+    if (result.value > limit || result.value < -limit) return fail (numbersStart - text);
+    return result;
+}
+
+size_t parseCoordinates (const char *buffer, const size_t length, CoordinateParse *results, const size_t maxResults)
+{
+    const char *p = buffer;
+    const char *end = buffer + length;
+    size_t count = 0;
+
+    while (p < end && count < maxResults)
+    {
+        const char *lineEnd = (const char *) memchr (p, '\n', end - p);
+        if (lineEnd == nullptr) lineEnd = end;
+        const char *contentEnd = lineEnd;
+        if (contentEnd > p && contentEnd[-1] == '\r') contentEnd--;
+
+        if (contentEnd > p) results[count++] = parseCoordinate (p, contentEnd - p);
+        p = lineEnd + 1;
+    }
+    return count;
+}
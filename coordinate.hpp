@@ -0,0 +1,90 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+
+/**
+ * @brief Axis of a parsed coordinate, from its hemisphere letter
+ */
+typedef enum
+{
+    /// No hemisphere letter: a plain signed number
+    COORDINATE_ANY
+    /// N or S
+    , COORDINATE_LATITUDE
+    /// E or W
+    , COORDINATE_LONGITUDE
+} CoordinateAxis;
+
+/**
+ * @brief Result of parseCoordinate
+ */
+struct CoordinateParse
+{
+    /// Decimal degrees, north and east positive
+    double         value;
+    /// Axis given by the hemisphere letter
+    CoordinateAxis axis;
+    /// True when the whole text was a valid coordinate
+    bool           ok;
+    /// When not ok: offset of the first character which could not be accepted
+    size_t         errorPosition;
+};
+
+/**
+ * @brief Parse a geographical coordinate
+ *
+ * Accepted are decimal degrees with an optional sign (<tt>-13.41</tt>) or hemisphere letter before or after
+ * the number (<tt>52.52N</tt>, <tt>W 0.12</tt>), and degrees, minutes and seconds separated by the usual
+ * symbols (<tt>°</tt>, <tt>'</tt>, <tt>"</tt>, also the Unicode prime and double prime), colons or blanks:
+ * <tt>52°31'12.5"N</tt>, <tt>52:31:12.5 N</tt>, <tt>52 31.2 N</tt>. Only the last component may have a
+ * fraction, minutes and seconds must be below 60, and a sign can't be combined with a hemisphere letter.
+ * Latitudes must be within +-90 degrees, longitudes and plain numbers within +-360 degrees.
+ *
+ * The text does not have to be null terminated, and nothing is allocated.
+ *
+ * @param text Start of the text
+ * @param length Length of the text in bytes
+ */
+CoordinateParse parseCoordinate (const char *text, const size_t length);
+
+/**
+ * @brief Parse a buffer of newline-separated coordinates
+ *
+ * Each line (a trailing carriage return is ignored) is parsed with parseCoordinate. Empty lines are skipped.
+ * The error positions of the results are relative to the start of their line.
+ *
+ * @param buffer Start of the buffer
+ * @param length Length of the buffer in bytes
+ * @param results Output array
+ * @param maxResults Size of the output array
+ * @return Number of results written
+ */
+size_t parseCoordinates (const char *buffer, const size_t length, CoordinateParse *results, const size_t maxResults);
@@ -0,0 +1,430 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <errno.h>
+#include <math.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "daemon.hpp"
+#include "ephemeris.hpp"
+#include "libsunwait.hpp"
+#include "sun.hpp"
+#include "suncache.hpp"
+#include "sweep.hpp"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0      // macOS: SIGPIPE is ignored by sunwaitd instead
+#endif
+
+static const size_t cReadChunk = 1 << 16;
+
+/*
+** Write all bytes, retrying on partial writes and signals
+*/
+static bool writeAll (const int fd, const char *data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t written = ::send (fd, data, length, MSG_NOSIGNAL);
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) return false;
+        data += written;
+        length -= (size_t) written;
+    }
+    return true;
+}
+
+/*
+** Read exactly length bytes
+*/
+static bool readAll (const int fd, char *data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t got = ::read (fd, data, length);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) return false;
+        data += got;
+        length -= (size_t) got;
+    }
+    return true;
+}
+
+static bool socketAddress (const char *path, struct sockaddr_un &address)
+{
+    memset (&address, 0, sizeof (address));
+    address.sun_family = AF_UNIX;
+    if (strlen (path) >= sizeof (address.sun_path))
+    {
+        printf ("Error: Socket path too long: %s\n", path);
+        return false;
+    }
+    strcpy (address.sun_path, path);
+    return true;
+}
+
+template <typename Record>
+inline void append (std::vector<char> &out, const Record &record)
+{
+    const char *bytes = (const char *) &record;
+    out.insert (out.end (), bytes, bytes + sizeof (Record));
+}
+
+SunDaemon::SunDaemon(const double cacheErrorSeconds)
+    : ephemeris{new ChebyshevEphemeris()}
+{
+    if (cacheErrorSeconds > 0.0) cache.reset (new SunCache(cacheErrorSeconds));
+}
+
+SunDaemon::~SunDaemon()
+{
+    stop ();
+    reap (true);
+    if (listenFd >= 0) ::close (listenFd);
+}
+
+bool SunDaemon::listen (const char *path)
+{
+    struct sockaddr_un address;
+    if (!socketAddress (path, address)) return false;
+
+    listenFd = socket (AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0)
+    {
+        printf ("Error: Couldn't create a socket: %s\n", strerror (errno));
+        return false;
+    }
+    unlink (path);
+    if (bind (listenFd, (struct sockaddr *) &address, sizeof (address)) < 0 || ::listen (listenFd, 128) < 0)
+    {
+        printf ("Error: Couldn't listen on %s: %s\n", path, strerror (errno));
+        ::close (listenFd);
+        listenFd = -1;
+        return false;
+    }
+    socketPath = path;
+    return true;
+}
+
+void SunDaemon::run ()
+{
+    // Wake up regularly to notice stop() and to join finished connections
+    struct pollfd listening = { listenFd, POLLIN, 0 };
+    while (!stopping.load () && listenFd >= 0)
+    {
+        reap (false);
+        if (::poll (&listening, 1, 100) <= 0) continue;
+        int fd = accept (listenFd, nullptr, nullptr);
+        if (fd < 0) continue;
+
+        std::lock_guard<std::mutex> lock (connectionsMutex);
+        if (connections.size () >= SUNWAITD_MAX_CONNECTIONS)
+        {
+            ::close (fd);
+            continue;
+        }
+        connections.push_back (std::unique_ptr<Connection> (new Connection()));
+        Connection *connection = connections.back ().get ();
+        connection->fd = fd;
+        connection->thread = std::thread (&SunDaemon::serve, this, connection);
+    }
+    reap (true);
+    if (!socketPath.empty ()) unlink (socketPath.c_str ());
+}
+
+void SunDaemon::stop ()
+{
+    stopping.store (true);
+}
+
+/*
+** Join finished connections, or (all) shut down and join every connection
+*/
+void SunDaemon::reap (const bool all)
+{
+    std::lock_guard<std::mutex> lock (connectionsMutex);
+    for (auto i = connections.begin (); i != connections.end (); )
+    {
+        Connection *connection = i->get ();
+        if (all && !connection->done.load ()) shutdown (connection->fd, SHUT_RDWR);
+        if (all || connection->done.load ())
+        {
+            connection->thread.join ();
+            ::close (connection->fd);
+            i = connections.erase (i);
+        }
+        else
+            ++i;
+    }
+}
+
+/*
+** Read whatever has arrived, answer all complete frames with one write (or one per SUNWAITD_MAX_PENDING
+** bytes of answers) and keep the rest
+*/
+void SunDaemon::serve (Connection *connection)
+{
+    std::vector<char> input (cReadChunk);
+    std::vector<char> output;
+    std::vector<SunQuery> queries;
+    size_t used = 0;
+
+    for (;;)
+    {
+        if (input.size () - used < cReadChunk) input.resize (used + cReadChunk);
+        ssize_t got = ::read (connection->fd, &input[used], input.size () - used);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) break;
+        used += (size_t) got;
+
+        size_t offset = 0;
+        output.clear ();
+        bool malformed = false;
+        while (used - offset >= sizeof (SunFrameHeader))
+        {
+            SunFrameHeader header;
+            memcpy (&header, &input[offset], sizeof (header));
+            if (header.length > SUNWAITD_MAX_FRAME || (uint64_t) header.count * sizeof (SunQuery) != header.length)
+            {
+                malformed = true;
+                break;
+            }
+            if (used - offset - sizeof (header) < header.length) break;
+
+            queries.resize (header.count);
+            if (header.count > 0) memcpy (queries.data (), &input[offset + sizeof (header)], header.length);
+            answer (queries.data (), header.count, output);
+            offset += sizeof (header) + header.length;
+
+            if (output.size () >= SUNWAITD_MAX_PENDING)
+            {
+                if (!writeAll (connection->fd, output.data (), output.size ())) break;
+                output.clear ();
+            }
+        }
+
+        if (output.size () >= SUNWAITD_MAX_PENDING) break;  // The write above failed
+        if (!output.empty () && !writeAll (connection->fd, output.data (), output.size ())) break;
+        if (malformed) break;
+        memmove (input.data (), &input[offset], used - offset);
+        used -= offset;
+    }
+    connection->done.store (true);
+}
+
+void SunDaemon::answer (const SunQuery *queries, const uint32_t count, std::vector<char> &out)
+{
+    size_t headerOffset = out.size ();
+    SunFrameHeader header = { 0, count };
+    append (out, header);
+
+    uint32_t entriesLeft = SUNWAITD_MAX_FRAME_ENTRIES;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        SunAnswer result;
+        memset (&result, 0, sizeof (result));
+        result.id = queries[i].id;
+        result.op = queries[i].op;
+        answerOne (queries[i], result, out, entriesLeft);
+    }
+
+    header.length = (uint32_t) (out.size () - headerOffset - sizeof (header));
+    memcpy (&out[headerOffset], &header, sizeof (header));
+    answered.fetch_add (count);
+}
+
+SunArc SunDaemon::arc (const SunQuery &query, const unsigned long day)
+{
+    if (cache) return cache->riset (query.latitude, query.longitude, query.twilightAngle, day, ephemeris.get ());
+
+    Sun sun(query.longitude, query.latitude, query.twilightAngle);
+    sun.ephemeris = ephemeris.get ();
+    return sun.riset (day);
+}
+
+/*
+** Answer one query; list entries are appended to out after the answer
+*/
+void SunDaemon::answerOne (const SunQuery &query, SunAnswer &result, std::vector<char> &out, uint32_t &entriesLeft)
+{
+    long day1970 = (long) (query.time >= 0 ? query.time / 86400 : (query.time - 86399) / 86400);
+    bool valid = std::isfinite (query.latitude) && fabs (query.latitude) <= 90.0
+                 && std::isfinite (query.longitude) && fabs (query.longitude) <= 180.0
+                 && std::isfinite (query.twilightAngle) && fabs (query.twilightAngle) < 90.0
+                 && std::isfinite (query.offsetHour)
+                 && (query.op != SUN_QUERY_LIST || (query.days >= 1 && query.days <= SUNWAITD_MAX_LIST_DAYS));
+    if (!valid || (query.op != SUN_QUERY_POLL && query.op != SUN_QUERY_NEXT && query.op != SUN_QUERY_LIST))
+    {
+        result.status = SUN_STATUS_BAD_QUERY;
+        append (out, result);
+        return;
+    }
+    if (query.op == SUN_QUERY_LIST)
+    {
+        if (query.days > entriesLeft)
+        {
+            result.status = SUN_STATUS_LIMIT;
+            append (out, result);
+            return;
+        }
+        entriesLeft -= query.days;
+    }
+
+    long day = day1970 - (DAYS_TO_2000);   // Sun::riset reads days before 2000 back as signed
+    int64_t midnightUTC = (int64_t) day1970 * 86400;
+    result.status = SUN_STATUS_OK;
+
+    if (query.op == SUN_QUERY_POLL)
+    {
+        // As SunWait::poll: within the offset day of yesterday, today or tomorrow
+        double seconds = (double) (query.time - midnightUTC);
+        result.value = EXIT_NIGHT;
+        for (int d = -1; d <= 1; d++)
+        {
+            SunArc a = arc (query, (unsigned long) (day + d));
+            a.southHourUTC += 24.0 * d;
+            if (seconds >= 3600.0 * a.getOffsetRiseHourUTC (query.offsetHour)
+                    && seconds <= 3600.0 * a.getOffsetSetHourUTC (query.offsetHour))
+                result.value = EXIT_DAY;
+        }
+        append (out, result);
+    }
+    else if (query.op == SUN_QUERY_NEXT)
+    {
+        SunWait sw(query.latitude, query.longitude, query.twilightAngle);
+        sw.offsetHour = query.offsetHour;
+        sw.ephemeris = ephemeris.get ();
+        sw.cache = cache.get ();
+        time_t next;
+        bool isRise;
+        if (sw.next_event ((time_t) query.time, &next, &isRise))
+        {
+            result.value = next;
+            result.kind = isRise ? SUN_EVENT_RISE : SUN_EVENT_SET;
+        }
+        else
+            result.status = SUN_STATUS_NO_EVENT;
+        append (out, result);
+    }
+    else
+    {
+        // As SunWait::list
+        result.count = query.days;
+        append (out, result);
+        for (int d = 0; d < query.days; d++)
+        {
+            SunArc a = arc (query, (unsigned long) (day + d));
+            double offsetArc = a.diurnalArcWithOffset (query.offsetHour);
+            double dayStart = (double) (midnightUTC + (int64_t) d * 86400);
+            SunListEntry entry;
+            if (offsetArc >= 24.0) entry.rise = entry.set = POLAR_DAY;
+            else if (offsetArc <= 0.0) entry.rise = entry.set = POLAR_NIGHT;
+            else
+            {
+                entry.rise = (int64_t) floor (dayStart + a.getOffsetRiseHourUTC (query.offsetHour) * 3600.0);
+                entry.set  = (int64_t) floor (dayStart + a.getOffsetSetHourUTC  (query.offsetHour) * 3600.0);
+            }
+            append (out, entry);
+        }
+    }
+}
+
+SunDaemonClient::~SunDaemonClient()
+{
+    close ();
+}
+
+bool SunDaemonClient::connect (const char *path)
+{
+    struct sockaddr_un address;
+    if (!socketAddress (path, address)) return false;
+
+    close ();
+    fd = socket (AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || ::connect (fd, (struct sockaddr *) &address, sizeof (address)) < 0)
+    {
+        printf ("Error: Couldn't connect to %s: %s\n", path, strerror (errno));
+        close ();
+        return false;
+    }
+    return true;
+}
+
+bool SunDaemonClient::send (const SunQuery *queries, const uint32_t count)
+{
+    if (fd < 0 || (uint64_t) count * sizeof (SunQuery) > SUNWAITD_MAX_FRAME) return false;
+
+    SunFrameHeader header = { (uint32_t) (count * sizeof (SunQuery)), count };
+    std::vector<char> frame;
+    frame.reserve (sizeof (header) + header.length);
+    append (frame, header);
+    frame.insert (frame.end (), (const char *) queries, (const char *) (queries + count));
+    return writeAll (fd, frame.data (), frame.size ());
+}
+
+bool SunDaemonClient::receive (std::vector<SunAnswer> &answers, std::vector<SunListEntry> &entries)
+{
+    answers.clear ();
+    entries.clear ();
+
+    SunFrameHeader header;
+    if (fd < 0 || !readAll (fd, (char *) &header, sizeof (header))) return false;
+    payload.resize (header.length);
+    if (header.length > 0 && !readAll (fd, payload.data (), header.length)) return false;
+
+    size_t offset = 0;
+    for (uint32_t i = 0; i < header.count; i++)
+    {
+        if (payload.size () - offset < sizeof (SunAnswer)) return false;
+        SunAnswer result;
+        memcpy (&result, &payload[offset], sizeof (result));
+        offset += sizeof (result);
+
+        if (result.count > 0)
+        {
+            if ((payload.size () - offset) / sizeof (SunListEntry) < result.count) return false;
+            result.value = (int64_t) entries.size ();
+            size_t first = entries.size ();
+            entries.resize (first + result.count);
+            memcpy (&entries[first], &payload[offset], result.count * sizeof (SunListEntry));
+            offset += result.count * sizeof (SunListEntry);
+        }
+        answers.push_back (result);
+    }
+    return true;
+}
+
+void SunDaemonClient::close ()
+{
+    if (fd >= 0) ::close (fd);
+    fd = -1;
+}
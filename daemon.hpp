@@ -0,0 +1,292 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sunarc.hpp"
+
+class ChebyshevEphemeris;
+class SunCache;
+
+/**
+ * @defgroup SunDaemonProtocol Definitions for the sunwaitd protocol
+ *
+ * @brief Defines of the binary protocol between sunwaitd and its clients
+ *
+ * A client sends frames, each a SunFrameHeader followed by count SunQuery records, and receives one frame
+ * per request frame, in the same order: a SunFrameHeader followed by count SunAnswer records, each followed
+ * by its SunListEntry records. Clients may send further frames before the answers of earlier ones have
+ * arrived (pipelining). All values are in host byte order, as the socket is local.
+ */
+/**
+ * @addtogroup SunDaemonProtocol
+ * @{
+ */
+/// Default path of the socket
+#define SUNWAITD_SOCKET "/tmp/sunwaitd.sock"
+/// Largest payload of a frame in bytes
+#define SUNWAITD_MAX_FRAME (1 << 20)
+/// Largest number of days of a SUN_QUERY_LIST
+#define SUNWAITD_MAX_LIST_DAYS 366
+/// Largest number of SunListEntry records in the answer to one frame (one MiB)
+#define SUNWAITD_MAX_FRAME_ENTRIES 65536
+/// Bytes of answers a connection holds before they are written (the write blocks until the client reads)
+#define SUNWAITD_MAX_PENDING (4 << 20)
+/// Largest number of connections served at once; further clients are disconnected at once
+#define SUNWAITD_MAX_CONNECTIONS 256
+/**@}*/
+
+/**
+ * @brief Kinds of queries
+ */
+typedef enum
+{
+    /// Is it day at the time? SunAnswer::value is EXIT_DAY or EXIT_NIGHT, as returned by SunWait::poll.
+    SUN_QUERY_POLL = 1
+    /// The first rise or set (moved by the offset) after the time, searched for up to a year ahead.
+    /// SunAnswer::value is its time, SunAnswer::kind a SunEventKind.
+    , SUN_QUERY_NEXT = 2
+    /// Rise and set of SunQuery::days days from the day of the time, as SunWait::list: SunAnswer::count SunListEntry follow.
+    , SUN_QUERY_LIST = 3
+} SunQueryOp;
+
+/**
+ * @brief Status of an answer
+ */
+typedef enum
+{
+    /// The answer holds the result
+    SUN_STATUS_OK = 0
+    /// The query was malformed (unknown op, coordinates or angle out of range)
+    , SUN_STATUS_BAD_QUERY = 1
+    /// There is no rise or set within a year (SUN_QUERY_NEXT)
+    , SUN_STATUS_NO_EVENT = 2
+    /// The list entries of the frame would exceed SUNWAITD_MAX_FRAME_ENTRIES (SUN_QUERY_LIST): the query is not answered
+    , SUN_STATUS_LIMIT = 3
+} SunQueryStatus;
+
+/**
+ * @brief Header of every frame
+ */
+struct SunFrameHeader
+{
+    /// Bytes following the header
+    uint32_t length;
+    /// Number of queries or answers
+    uint32_t count;
+};
+
+/**
+ * @brief A query, as sent to sunwaitd
+ */
+struct SunQuery
+{
+    /// Chosen by the client and returned in the answer
+    uint32_t id;
+    /// A SunQueryOp
+    uint8_t  op;
+    uint8_t  reserved;
+    /// Number of days of a SUN_QUERY_LIST
+    uint16_t days;
+    /// Geographical latitude in decimal degrees (N positive, S negative)
+    double   latitude;
+    /// Geographical longitude in decimal degrees (E positive, W negative)
+    double   longitude;
+    /// Twilight angle in degrees, see SunWait::twilightAngle
+    double   twilightAngle;
+    /// Offset towards midday in hours, see SunWait::offsetHour
+    double   offsetHour;
+    /// Time of the query in seconds since the epoch
+    int64_t  time;
+};
+
+/**
+ * @brief An answer, as received from sunwaitd
+ */
+struct SunAnswer
+{
+    /// SunQuery::id of the query
+    uint32_t id;
+    /// SunQueryOp of the query
+    uint8_t  op;
+    /// A SunQueryStatus
+    uint8_t  status;
+    /// SunEventKind of a SUN_QUERY_NEXT
+    uint8_t  kind;
+    uint8_t  reserved;
+    /// Number of SunListEntry following the answer
+    uint32_t count;
+    uint32_t reserved2;
+    /// Result, see SunQueryOp. For SUN_QUERY_LIST, SunDaemonClient::receive sets it to the index of the first entry.
+    int64_t  value;
+};
+
+/**
+ * @brief Rise and set of one day; both POLAR_DAY or POLAR_NIGHT in polar day or night
+ */
+struct SunListEntry
+{
+    /// Time of the rise
+    int64_t rise;
+    /// Time of the set
+    int64_t set;
+};
+
+static_assert (sizeof (SunFrameHeader) == 8 && sizeof (SunQuery) == 48 && sizeof (SunAnswer) == 24
+               && sizeof (SunListEntry) == 16, "sunwaitd records must not contain padding");
+
+/**
+ * @brief Query server on a Unix domain socket
+ *
+ * One ephemeris and one SunCache are shared by all connections, each of which is served by its own thread.
+ * All complete frames read from a connection are answered with one write, so pipelined frames are batched,
+ * up to SUNWAITD_MAX_PENDING bytes of answers. At most SUNWAITD_MAX_CONNECTIONS connections are served at once.
+ */
+class SunDaemon
+{
+    public:
+    /**
+     * @brief Construct a server
+     *
+     * @param cacheErrorSeconds Error bound of the shared SunCache; 0 to compute every arc exactly
+     */
+        SunDaemon(const double cacheErrorSeconds = 1.0);
+        ~SunDaemon();
+
+    /**
+     * @brief Create the socket (replacing a stale one at the path)
+     *
+     * @param path Path of the socket
+     * @return Return true when successful.
+     */
+        bool listen (const char *path = SUNWAITD_SOCKET);
+
+    /**
+     * @brief Accept and serve connections until stop() is called, then close them and remove the socket
+     */
+        void run ();
+
+    /**
+     * @brief Make run() return; may be called from any thread or a signal handler
+     */
+        void stop ();
+
+    /**
+     * @brief Answer the queries of one frame
+     *
+     * @param queries Queries
+     * @param count Number of queries
+     * @param out The answer frame (header, answers and list entries) is appended
+     */
+        void answer (const SunQuery *queries, const uint32_t count, std::vector<char> &out);
+
+    /// Number of queries answered
+        uint64_t queries () const
+        {
+            return answered.load ();
+        }
+
+    private:
+        struct Connection
+        {
+            int fd;
+            std::thread thread;
+            std::atomic<bool> done{false};
+        };
+
+        std::unique_ptr<ChebyshevEphemeris> ephemeris;
+        std::unique_ptr<SunCache> cache;
+        int listenFd = -1;
+        std::string socketPath;
+        std::atomic<bool> stopping{false};
+        std::atomic<uint64_t> answered{0};
+        std::mutex connectionsMutex;
+        std::list<std::unique_ptr<Connection>> connections;
+
+        void serve (Connection *connection);
+        void reap (const bool all);
+        SunArc arc (const SunQuery &query, const unsigned long day);
+        void answerOne (const SunQuery &query, SunAnswer &answer, std::vector<char> &out, uint32_t &entriesLeft);
+};
+
+/**
+ * @brief Client of sunwaitd
+ *
+ * Each send() writes one frame; receive() returns the answers of the oldest frame not yet received.
+ */
+class SunDaemonClient
+{
+    public:
+        SunDaemonClient() = default;
+        ~SunDaemonClient();
+        SunDaemonClient(const SunDaemonClient &) = delete;
+        SunDaemonClient &operator= (const SunDaemonClient &) = delete;
+
+    /**
+     * @brief Connect to a server
+     *
+     * @param path Path of the socket
+     * @return Return true when successful.
+     */
+        bool connect (const char *path = SUNWAITD_SOCKET);
+
+    /**
+     * @brief Send a frame of queries
+     *
+     * @param queries Queries
+     * @param count Number of queries
+     * @return Return true when successful.
+     */
+        bool send (const SunQuery *queries, const uint32_t count);
+
+    /**
+     * @brief Receive the answers to the oldest frame sent
+     *
+     * @param answers Replaced by the answers
+     * @param entries Replaced by the list entries of all SUN_QUERY_LIST answers
+     * @return Return true when successful.
+     */
+        bool receive (std::vector<SunAnswer> &answers, std::vector<SunListEntry> &entries);
+
+    /// Close the connection
+        void close ();
+
+    private:
+        int fd = -1;
+        std::vector<char> payload;
+};
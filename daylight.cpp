@@ -0,0 +1,159 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#include <math.h>
+#include <initializer_list>
+
+#include "daylight.hpp"
+#include "sun.hpp"
+#include "ephemeris.hpp"
+
+/* Calendar year and month (UTC) of a day since 2000, from the proleptic Gregorian calendar */
+static void yearMonth (const unsigned long daysSince2000, int *year, int *month)
+{
+    long z = (long) daysSince2000 + (DAYS_TO_2000) + 719468;    // days since 0000-03-01
+    long era = z / 146097;
+    long dayOfEra = z - era * 146097;
+    long yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    long dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    long monthIndex = (5 * dayOfYear + 2) / 153;                 // from March
+    *month = (int) (monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+    *year = (int) (yearOfEra + era * 400 + (*month <= 2 ? 1 : 0));
+}
+
+static void startPeriod (SunDaylightStats *row, const size_t sites, const int year, const int month)
+{
+    for (size_t s = 0; s < sites; s++)
+    {
+        SunDaylightStats &stats = row[s];
+        stats.year = year;
+        stats.month = month;
+        stats.days = 0;
+        stats.totalDaylight = 0.0;
+        stats.minDaylight = 24.0;
+        stats.maxDaylight = 0.0;
+        stats.meanDaylight = 0.0;
+        stats.civilTwilight = 0.0;
+        stats.nauticalTwilight = 0.0;
+        stats.astronomicalTwilight = 0.0;
+        stats.night = 0.0;
+    }
+}
+
+static inline void addDay (SunDaylightStats &stats, const double arcs[4])
+{
+    stats.days++;
+    stats.totalDaylight += arcs[0];
+    stats.minDaylight = fmin (stats.minDaylight, arcs[0]);
+    stats.maxDaylight = fmax (stats.maxDaylight, arcs[0]);
+    stats.civilTwilight += arcs[1] - arcs[0];
+    stats.nauticalTwilight += arcs[2] - arcs[1];
+    stats.astronomicalTwilight += arcs[3] - arcs[2];
+    stats.night += 24.0 - arcs[3];
+}
+
+SunDaylight::SunDaylight(const std::vector<SunSite> &sites, const ChebyshevEphemeris *eph)
+    : sinLatitude(sites.size ()), cosLatitude(sites.size ()), ephemeris{eph}
+{
+    for (size_t s = 0; s < sites.size (); s++)
+    {
+        sinLatitude[s] = sind(sites[s].latitude);
+        cosLatitude[s] = cosd(sites[s].latitude);
+    }
+}
+
+void SunDaylight::aggregate (const unsigned long firstDay, const int days, std::vector<SunDaylightStats> *months,
+                             std::vector<SunDaylightStats> *years) const
+{
+    const size_t sites = sinLatitude.size ();
+    if (months != nullptr) months->clear ();
+    if (years != nullptr) years->clear ();
+    if (days <= 0) return;
+
+    // Size the outputs for all periods up front
+    int firstYear, firstMonth, lastYear, lastMonth;
+    yearMonth (firstDay, &firstYear, &firstMonth);
+    yearMonth (firstDay + days - 1, &lastYear, &lastMonth);
+    const int monthCount = (lastYear - firstYear) * 12 + lastMonth - firstMonth + 1;
+    const int yearCount = lastYear - firstYear + 1;
+    if (months != nullptr)
+    {
+        months->resize ((size_t) monthCount * sites);
+        for (int p = 0; p < monthCount; p++)
+            startPeriod (&(*months)[(size_t) p * sites], sites, firstYear + (firstMonth - 1 + p) / 12,
+                         (firstMonth - 1 + p) % 12 + 1);
+    }
+    if (years != nullptr)
+    {
+        years->resize ((size_t) yearCount * sites);
+        for (int p = 0; p < yearCount; p++) startPeriod (&(*years)[(size_t) p * sites], sites, firstYear + p, 0);
+    }
+
+    for (int day = 0; day < days; day++)
+    {
+        const unsigned long daysSince2000 = firstDay + day;
+        int year, month;
+        yearMonth (daysSince2000, &year, &month);
+        SunDaylightStats *monthRow = months != nullptr ?
+                                     &(*months)[(size_t) ((year - firstYear) * 12 + month - firstMonth) * sites] : nullptr;
+        SunDaylightStats *yearRow = years != nullptr ? &(*years)[(size_t) (year - firstYear) * sites] : nullptr;
+
+        // The sun's position as Sun::riset takes it: daylight for the upper limb, twilight for the centre
+        double sra, sdec, sr;
+        const double d = (double) (long) daysSince2000 + 1.5;  // Noon UTC of the day (days before 2000 too), as in Sun::riset
+        if (ephemeris != nullptr && ephemeris->covers (d))
+            ephemeris->sun_RA_dec (d, &sra, &sdec, &sr);
+        else
+            Sun::sun_RA_dec (d, &sra, &sdec, &sr);
+        const double sinDec = sind(sdec), cosDec = cosd(sdec);
+        const double sinAltitude[4] = { sind((TWILIGHT_ANGLE_DAYLIGHT) - 0.2666 / sr), sind(TWILIGHT_ANGLE_CIVIL),
+                                        sind(TWILIGHT_ANGLE_NAUTICAL), sind(TWILIGHT_ANGLE_ASTRONOMICAL)
+                                      };
+
+        for (size_t s = 0; s < sites; s++)
+        {
+            const double offset = sinLatitude[s] * sinDec;
+            const double amplitude = cosLatitude[s] * cosDec;
+            double arcs[4];
+            for (int k = 0; k < 4; k++)
+            {
+                // Clamped: cos H >= 1 is polar night (arc 0), <= -1 midnight sun (arc 24)
+                double cost = fmin (fmax ((sinAltitude[k] - offset) / amplitude, -1.0), 1.0);
+                arcs[k] = 2.0 * acosd(cost) / 15.0;
+            }
+            if (monthRow != nullptr) addDay (monthRow[s], arcs);
+            if (yearRow != nullptr) addDay (yearRow[s], arcs);
+        }
+    }
+
+    for (std::vector<SunDaylightStats> *output : { months, years })
+        if (output != nullptr)
+            for (SunDaylightStats &stats : *output)
+                stats.meanDaylight = stats.days > 0 ? stats.totalDaylight / stats.days : 0.0;
+}
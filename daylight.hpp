@@ -0,0 +1,110 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#pragma once
+
+#include <vector>
+
+#include "libsunwait.hpp"
+
+/**
+ * @brief Daylight and twilight of one site over one month or year
+ *
+ * Durations are in hours. Daylight is from sun rise to sun set (upper limb at TWILIGHT_ANGLE_DAYLIGHT),
+ * each twilight band the time the centre of the sun spends between the band's limits, mornings and
+ * evenings together, and night the time below astronomical twilight. The five add up to 24 hours a day.
+ * Polar days and nights count as 24 and 0 hours of daylight.
+ */
+struct SunDaylightStats
+{
+    /// Calendar year (UTC)
+    int year;
+    /// Month 1 to 12, or 0 for the whole year
+    int month;
+    /// Number of days aggregated: fewer than the period has where the range starts or ends within it
+    int days;
+    /// Total daylight
+    double totalDaylight;
+    /// Shortest daylight of a day
+    double minDaylight;
+    /// Longest daylight of a day
+    double maxDaylight;
+    /// Mean daylight per day
+    double meanDaylight;
+    /// Total civil twilight (sun between TWILIGHT_ANGLE_DAYLIGHT and TWILIGHT_ANGLE_CIVIL)
+    double civilTwilight;
+    /// Total nautical twilight (sun between TWILIGHT_ANGLE_CIVIL and TWILIGHT_ANGLE_NAUTICAL)
+    double nauticalTwilight;
+    /// Total astronomical twilight (sun between TWILIGHT_ANGLE_NAUTICAL and TWILIGHT_ANGLE_ASTRONOMICAL)
+    double astronomicalTwilight;
+    /// Total night
+    double night;
+};
+
+/**
+ * @brief Daylight statistics of many sites over a range of days
+ *
+ * Works from the diurnal arcs of Sun::riset at the four altitudes. The sun's position is computed once per day
+ * for all sites, and the arcs are evaluated site by site without branches (polar days and nights fall out of
+ * the clamped arc cosine), so the loops vectorise. All buffers are allocated when the statistics are sized,
+ * before the first day.
+ */
+class SunDaylight
+{
+    public:
+    /**
+     * @brief Prepare the site terms
+     *
+     * @param sites Site set (only the positions are used)
+     * @param ephemeris Optional precomputed ephemeris, see SunWait::ephemeris
+     */
+        SunDaylight(const std::vector<SunSite> &sites, const ChebyshevEphemeris *ephemeris = nullptr);
+
+    /**
+     * @brief Aggregate a range of days per month and per year
+     *
+     * The periods are calendar months and years in UTC. Both outputs are period-major: the statistics of
+     * site s in period p are at index p * sites + s, in the order of the site set and chronologically.
+     *
+     * @param firstDay First day, days since 2000
+     * @param days Number of days
+     * @param months Output per month (optional)
+     * @param years Output per year (optional)
+     */
+        void aggregate (const unsigned long firstDay, const int days, std::vector<SunDaylightStats> *months,
+                        std::vector<SunDaylightStats> *years) const;
+
+    /// Number of sites
+        size_t size () const { return sinLatitude.size (); }
+
+    private:
+        std::vector<double> sinLatitude;
+        std::vector<double> cosLatitude;
+        const ChebyshevEphemeris *ephemeris;
+};
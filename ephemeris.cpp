@@ -0,0 +1,235 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <math.h>
+
+#include "ephemeris.hpp"
+#include "sun.hpp"
+#include "libsunwait.hpp"
+
+static const char cMagic[8] = "SWEPH02";
+
+// Wrap an angle (at most one revolution off) to -180..180 degrees without fmod
+inline double wrap180 (double x)
+{
+    if (x >  180.0) x -= 360.0;
+    if (x < -180.0) x += 360.0;
+    return x;
+}
+
+// Sum of c[k] T_k(t) by Clenshaw's recurrence, c[0] is already halved
+inline double clenshaw (const double *c, const int order, const double t)
+{
+    double t2 = 2.0 * t;
+    double b1 = 0.0, b2 = 0.0;
+    for (int k = order; k >= 1; k--)
+    {
+        double b0 = c[k] + t2 * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+    return c[0] + t * b1 - b2;
+}
+
+/* The analytic formulas of a backend */
+static void analytic (const SunPositionBackend backend, const double d, double *RA, double *dec, double *r)
+{
+    if (backend == SUN_POSITION_NOAA) SunNOAA::sun_RA_dec (d, RA, dec, r);
+    else Sun::sun_RA_dec (d, RA, dec, r);
+}
+
+/* The sidereal time of a backend, so the hour angle matches its right ascension */
+static double analyticGMST0 (const SunPositionBackend backend, const double d)
+{
+    return backend == SUN_POSITION_NOAA ? SunNOAA::GMST0 (d) : Sun::GMST0 (d);
+}
+
+ChebyshevEphemeris::ChebyshevEphemeris(double first, double last, double segmentLength, int polyOrder,
+                                       SunPositionBackend position)
+    : firstDay{first}, segmentDays{segmentLength}, order{polyOrder}, backend{position}
+{
+    if (segmentDays <= 0.0 || order < 1 || last <= first)
+    {
+        printf ("Error: Invalid ephemeris range, segment length or order. No table created.\n");
+        return;
+    }
+    segments = (int) ceil ((last - first) / segmentDays);
+    coefficients.resize ((size_t) segments * 3 * (order + 1));
+    for (int s = 0; s < segments; s++) fit (s);
+}
+
+/*
+** Sample the analytic formulas at the Chebyshev nodes of one segment and
+** compute the polynomial coefficients. The right ascension jumps by 360 degrees
+** once a year, so it is unwrapped relative to the first node before fitting.
+*/
+void ChebyshevEphemeris::fit (const int segment)
+{
+    const int nodes = order + 1;
+    std::vector<double> RA (nodes), dec (nodes), r (nodes), x (nodes);
+    double mid  = firstDay + segmentDays * (segment + 0.5);
+    double half = segmentDays / 2.0;
+
+    for (int j = 0; j < nodes; j++)
+    {
+        x[j] = cos (PI * (j + 0.5) / nodes);
+        analytic (backend, mid + half * x[j], &RA[j], &dec[j], &r[j]);
+        if (j > 0) RA[j] = RA[0] + wrap180 (RA[j] - RA[0]);
+    }
+
+    double *c = &coefficients[(size_t) segment * 3 * nodes];
+    for (int k = 0; k < nodes; k++)
+    {
+        double sumRA = 0.0, sumDec = 0.0, sumR = 0.0;
+        for (int j = 0; j < nodes; j++)
+        {
+            double Tk = cos (k * PI * (j + 0.5) / nodes);
+            sumRA  += RA[j]  * Tk;
+            sumDec += dec[j] * Tk;
+            sumR   += r[j]   * Tk;
+        }
+        double scale = (k == 0 ? 1.0 : 2.0) / nodes;
+        c[k]             = sumRA  * scale;
+        c[nodes + k]     = sumDec * scale;
+        c[2 * nodes + k] = sumR   * scale;
+    }
+}
+
+void ChebyshevEphemeris::sun_RA_dec (const double d, double *RA, double *dec, double *r) const
+{
+    const int nodes = order + 1;
+    int segment = (int) ((d - firstDay) / segmentDays);
+    if (segment >= segments) segment = segments - 1;
+    double t = (d - firstDay) / segmentDays * 2.0 - (2 * segment + 1);
+
+    const double *c = &coefficients[(size_t) segment * 3 * nodes];
+    *RA  = wrap180 (clenshaw (c,             order, t));
+    *dec =          clenshaw (c + nodes,     order, t);
+    *r   =          clenshaw (c + 2 * nodes, order, t);
+}
+
+EphemerisError ChebyshevEphemeris::validate (const double step) const
+{
+    EphemerisError maxError = {0.0, 0.0, 0.0};
+    double last = firstDay + segmentDays * segments;
+
+    for (double d = firstDay; d < last; d += step)
+    {
+        double RA, dec, r, refRA, refDec, refR;
+        sun_RA_dec (d, &RA, &dec, &r);
+        analytic (backend, d, &refRA, &refDec, &refR);
+
+        double errRA  = fabs (wrap180 (RA - refRA));
+        double errDec = fabs (dec - refDec);
+        double errR   = fabs (r - refR);
+        if (errRA  > maxError.RA)  maxError.RA  = errRA;
+        if (errDec > maxError.dec) maxError.dec = errDec;
+        if (errR   > maxError.r)   maxError.r   = errR;
+    }
+    return maxError;
+}
+
+bool ChebyshevEphemeris::save (const char *path) const
+{
+    FILE *file = fopen (path, "wb");
+    if (file == nullptr)
+    {
+        printf ("Error: Couldn't open ephemeris file %s for writing.\n", path);
+        return false;
+    }
+    int  backendCode = (int) backend;
+    bool ok = fwrite (cMagic, sizeof (cMagic), 1, file) == 1
+              && fwrite (&firstDay,    sizeof (firstDay),    1, file) == 1
+              && fwrite (&segmentDays, sizeof (segmentDays), 1, file) == 1
+              && fwrite (&order,       sizeof (order),       1, file) == 1
+              && fwrite (&segments,    sizeof (segments),    1, file) == 1
+              && fwrite (&backendCode, sizeof (backendCode), 1, file) == 1
+              && fwrite (coefficients.data (), sizeof (double), coefficients.size (), file) == coefficients.size ();
+    ok = (fclose (file) == 0) && ok;
+    if (!ok) printf ("Error: Couldn't write ephemeris file %s.\n", path);
+    return ok;
+}
+
+bool ChebyshevEphemeris::load (const char *path)
+{
+    FILE *file = fopen (path, "rb");
+    if (file == nullptr)
+    {
+        printf ("Error: Couldn't open ephemeris file %s.\n", path);
+        return false;
+    }
+
+    char   magic[sizeof (cMagic)];
+    double newFirstDay, newSegmentDays;
+    int    newOrder, newSegments, newBackend;
+    bool ok = fread (magic, sizeof (magic), 1, file) == 1
+              && memcmp (magic, cMagic, sizeof (cMagic)) == 0
+              && fread (&newFirstDay,    sizeof (newFirstDay),    1, file) == 1
+              && fread (&newSegmentDays, sizeof (newSegmentDays), 1, file) == 1
+              && fread (&newOrder,       sizeof (newOrder),       1, file) == 1
+              && fread (&newSegments,    sizeof (newSegments),    1, file) == 1
+              && fread (&newBackend,     sizeof (newBackend),     1, file) == 1
+              && newSegmentDays > 0.0 && newOrder >= 1 && newOrder < 64 && newSegments > 0
+              && (newBackend == SUN_POSITION_SCHLYTER || newBackend == SUN_POSITION_NOAA);
+
+    std::vector<double> newCoefficients;
+    if (ok)
+    {
+        newCoefficients.resize ((size_t) newSegments * 3 * (newOrder + 1));
+        ok = fread (newCoefficients.data (), sizeof (double), newCoefficients.size (), file) == newCoefficients.size ();
+    }
+    fclose (file);
+
+    if (!ok)
+    {
+        printf ("Error: %s is not a valid ephemeris file.\n", path);
+        return false;
+    }
+
+    firstDay     = newFirstDay;
+    segmentDays  = newSegmentDays;
+    order        = newOrder;
+    segments     = newSegments;
+    backend      = (SunPositionBackend) newBackend;
+    coefficients.swap (newCoefficients);
+    return true;
+}
+
+void sunAtInstant (const ChebyshevEphemeris *ephemeris, const double t, double *dec, double *r, double *hourAngle)
+{
+    double d = t / 86400.0 - (DAYS_TO_2000) + 1.0;
+    SunPositionBackend backend = ephemeris != nullptr ? ephemeris->position () : SUN_POSITION_SCHLYTER;
+    double RA;
+    if (ephemeris != nullptr && ephemeris->covers (d)) ephemeris->sun_RA_dec (d, &RA, dec, r);
+    else analytic (backend, d, &RA, dec, r);
+
+    double ut = (d - floor (d)) * 24.0;
+    *hourAngle = analyticGMST0 (backend, d) + 15.0 * ut - RA;
+}
@@ -0,0 +1,177 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "sunarc.hpp"
+
+/**
+ * @defgroup EphemerisRange Definitions for the default ephemeris range
+ *
+ * @brief Defines for the range covered by a default ChebyshevEphemeris
+ *
+ * The range is given in days since 2000 (as used by SunWait) and spans 1900-01-01 to 2101-01-01.
+ */
+/**
+ * @addtogroup EphemerisRange
+ * @{
+ */
+/// First day (days since 2000) covered by default
+#define EPHEMERIS_FIRST_DAY    -36524.0
+/// Last day (days since 2000) covered by default
+#define EPHEMERIS_LAST_DAY      36890.0
+/// Length of one polynomial segment in days
+#define EPHEMERIS_SEGMENT_DAYS  32.0
+/// Order of the polynomial of each segment
+#define EPHEMERIS_ORDER         8
+/**@}*/
+
+/**
+ * @brief Maximum deviations of a ChebyshevEphemeris from the analytic formulas it was fitted to
+ */
+struct EphemerisError
+{
+    /// Right ascension, degrees
+    double RA;
+    /// Declination, degrees
+    double dec;
+    /// Solar distance, astronomical units
+    double r;
+};
+
+/**
+ * @brief Piecewise Chebyshev representation of the solar ephemeris
+ *
+ * The right ascension, declination and distance of the Sun are smooth functions of the day number.
+ * They are fitted once by Chebyshev polynomials over segments of a few weeks and afterwards evaluated
+ * with a handful of multiply-adds instead of the trigonometric functions of the analytic formulas.
+ * The sidereal time GMST0 is linear in the day number and needs no table.
+ *
+ * The table is built from the analytic formulas when the object is constructed (this takes a few milliseconds
+ * for the default range) or can be loaded from a file written earlier with save().
+ * A single object can be shared by any number of SunWait instances (set SunWait::ephemeris) and threads, as it is
+ * never modified after construction or load().
+ */
+class ChebyshevEphemeris
+{
+    public:
+    /**
+     * @brief Construct the table by fitting the analytic formulas
+     *
+     * @param firstDay First day covered (days since 2000)
+     * @param lastDay Last day covered (days since 2000)
+     * @param segmentDays Length of each segment in days
+     * @param order Order of the Chebyshev polynomials
+     * @param position Analytic formulas to fit. A table fitted to SUN_POSITION_NOAA gives the batch classes
+     * (which take a ChebyshevEphemeris) the accuracy of that backend at the cost of the table lookup.
+     */
+        ChebyshevEphemeris(double firstDay = EPHEMERIS_FIRST_DAY, double lastDay = EPHEMERIS_LAST_DAY,
+                           double segmentDays = EPHEMERIS_SEGMENT_DAYS, int order = EPHEMERIS_ORDER,
+                           SunPositionBackend position = SUN_POSITION_SCHLYTER);
+
+    /**
+     * @brief Replace the table with one written by save()
+     *
+     * The file records the analytic formulas the table was fitted to, which replace those given to the
+     * constructor, so validate() and position() describe the loaded table.
+     *
+     * @param path File name
+     * @return Return true when successful. The table is left unchanged otherwise.
+     */
+        bool load (const char *path);
+
+    /**
+     * @brief Write the table to a file which can be read with load()
+     *
+     * @param path File name
+     * @return Return true when successful.
+     */
+        bool save (const char *path) const;
+
+    /**
+     * @brief Whether the given day is covered by the table
+     *
+     * @param d Days since 2000
+     */
+        bool covers (const double d) const
+        {
+            return d >= firstDay && d < firstDay + segmentDays * segments;
+        }
+
+    /**
+     * @brief Evaluate the solar position (same conventions as Sun::sun_RA_dec)
+     *
+     * The day must be covered by the table, see covers().
+     *
+     * @param d Days since 2000
+     * @param RA Right ascension in degrees (-180 to 180)
+     * @param dec Declination in degrees
+     * @param r Distance in astronomical units
+     */
+        void sun_RA_dec (const double d, double *RA, double *dec, double *r) const;
+
+    /**
+     * @brief Compare the table with the analytic formulas given to the constructor
+     *
+     * @param step Sampling step in days
+     * @return The maximum absolute deviations found over the covered range
+     */
+        EphemerisError validate (const double step = 0.25) const;
+
+    /**
+     * @brief The analytic formulas the table was fitted to
+     */
+        SunPositionBackend position () const { return backend; }
+
+    private:
+        double firstDay;
+        double segmentDays;
+        int    order;
+        int    segments = 0;
+        SunPositionBackend backend;
+        std::vector<double> coefficients; // per segment: RA, dec and r, each with (order + 1) coefficients
+
+        void fit (const int segment);
+};
+
+/**
+ * @brief The sun's position at an instant, as used by SunTrack, SunIrradiance and SunExposure
+ *
+ * The day number counts from 2000 Jan 0.0, as the formulas do, and GMST0 + 15 * UT is the sidereal time at
+ * Greenwich; a site's local hour angle adds its longitude.
+ *
+ * @param ephemeris Table to evaluate when it covers the instant, otherwise the formulas of its position()
+ * (Sun::sun_RA_dec when nullptr)
+ * @param t Seconds since 1970-01-01 (UTC)
+ * @param dec Declination in degrees
+ * @param r Distance in astronomical units
+ * @param hourAngle Hour angle at Greenwich in degrees
+ */
+void sunAtInstant (const ChebyshevEphemeris *ephemeris, const double t, double *dec, double *r, double *hourAngle);
@@ -0,0 +1,323 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#include <math.h>
+#include <algorithm>
+
+#include "facade.hpp"
+#include "sun.hpp"
+#include "ephemeris.hpp"
+#include "root.hpp"
+
+static const double cTimeTolerance = 1e-3;      // seconds
+static const int    cMaxIterations = 60;
+
+/* Kinds of boundary: the altitude, or an azimuth */
+static const int cAltitude = 0;
+static const int cAzimuth  = 1;
+
+/* Reduce an angle to -180 < x <= 180 degrees */
+static inline double rev180 (const double x)
+{
+    double y = fmod (x, 360.0);
+    if (y > 180.0) y -= 360.0;
+    if (y <= -180.0) y += 360.0;
+    return y;
+}
+
+/*
+** An azimuth boundary is crossed where the difference to it changes sign close to it. Far from it, at
+** the opposite azimuth, the difference jumps from +180 to -180 degrees.
+*/
+static inline bool crossesAzimuth (const double before, const double after)
+{
+    return (before < 0.0) != (after < 0.0) && fabs (before) < 90.0 && fabs (after) < 90.0;
+}
+
+SunExposure::SunExposure(const std::vector<SunFacade> &facades, const ChebyshevEphemeris *eph, const double stepSeconds)
+    : ephemeris{eph}, step{stepSeconds > 1.0 ? stepSeconds : 1.0}
+{
+    // One site per distinct position, in the order of first use
+    std::vector<size_t> order (facades.size ());
+    for (size_t f = 0; f < facades.size (); f++) order[f] = f;
+    std::stable_sort (order.begin (), order.end (), [&facades] (size_t a, size_t b)
+    {
+        if (facades[a].latitude != facades[b].latitude) return facades[a].latitude < facades[b].latitude;
+        return facades[a].longitude < facades[b].longitude;
+    });
+
+    sectors.resize (facades.size ());
+    for (size_t i = 0; i < order.size (); i++)
+    {
+        const SunFacade &facade = facades[order[i]];
+        if (i == 0 || facade.latitude != facades[order[i - 1]].latitude
+                   || facade.longitude != facades[order[i - 1]].longitude)
+        {
+            Site site;
+            site.sinLatitude = sind(facade.latitude);
+            site.cosLatitude = cosd(facade.latitude);
+            site.cosLongitude = cosd(facade.longitude);
+            site.sinLongitude = sind(facade.longitude);
+            sites.push_back (site);
+        }
+
+        Sector &sector = sectors[order[i]];
+        sector.site = sites.size () - 1;
+        sector.from = fmod (fmod (facade.azimuthFrom, 360.0) + 360.0, 360.0);
+        sector.width = fmod (fmod (facade.azimuthTo - facade.azimuthFrom, 360.0) + 360.0, 360.0);
+        if (sector.width == 0.0) sector.width = 360.0;
+        sector.sinAltitude = sind(facade.minAltitude);
+    }
+}
+
+/*
+** The sun's position at an instant, shared by all sites
+*/
+SunExposure::SunOfInstant SunExposure::sunOf (const double t) const
+{
+    double dec, r, hourAngle;
+    sunAtInstant (ephemeris, t, &dec, &r, &hourAngle);
+
+    SunOfInstant sun;
+    sun.sinDec = sind(dec);
+    sun.cosDec = cosd(dec);
+    sun.cosHourAngle = cosd(hourAngle);
+    sun.sinHourAngle = sind(hourAngle);
+    return sun;
+}
+
+/*
+** Altitude and azimuth from the local hour angle H = H(Greenwich) + lon, expanded with the site's terms:
+**     sin h = sin lat sin dec + cos lat cos dec cos H
+**     tan A = -cos dec sin H / (sin dec cos lat - cos dec cos H sin lat)
+*/
+void SunExposure::altitudeAzimuth (const Site &site, const SunOfInstant &sun, double *sinAltitude, double *azimuth)
+{
+    double cosH = sun.cosHourAngle * site.cosLongitude - sun.sinHourAngle * site.sinLongitude;
+    double sinH = sun.sinHourAngle * site.cosLongitude + sun.cosHourAngle * site.sinLongitude;
+    *sinAltitude = site.sinLatitude * sun.sinDec + site.cosLatitude * sun.cosDec * cosH;
+    double a = atan2d(-sun.cosDec * sinH, sun.sinDec * site.cosLatitude - sun.cosDec * cosH * site.sinLatitude);
+    *azimuth = a < 0.0 ? a + 360.0 : a;
+}
+
+bool SunExposure::inside (const Sector &sector, const double sinAltitude, const double azimuth)
+{
+    if (sinAltitude <= sector.sinAltitude) return false;
+    double offset = azimuth - sector.from;
+    if (offset < 0.0) offset += 360.0;
+    return offset <= sector.width;
+}
+
+/*
+** Time the boundary is crossed between lo and hi, which bracket it
+*/
+double SunExposure::root (const Site &site, const int kind, const double value, double lo, double hi) const
+{
+    auto boundary = [this, &site, kind, value] (const double t)
+    {
+        double sinAltitude, azimuth;
+        altitudeAzimuth (site, sunOf (t), &sinAltitude, &azimuth);
+        return kind == cAltitude ? sinAltitude - value : rev180 (azimuth - value);
+    };
+
+    return illinoisRoot (boundary, lo, boundary (lo), hi, boundary (hi), cTimeTolerance, cMaxIterations);
+}
+
+void SunExposure::position (const double t, const double latitude, const double longitude, double *azimuth,
+                            double *altitude) const
+{
+    Site site;
+    site.sinLatitude = sind(latitude);
+    site.cosLatitude = cosd(latitude);
+    site.cosLongitude = cosd(longitude);
+    site.sinLongitude = sind(longitude);
+    double sinAltitude;
+    altitudeAzimuth (site, sunOf (t), &sinAltitude, azimuth);
+    *altitude = asind(fmax (fmin (sinAltitude, 1.0), -1.0));
+}
+
+bool SunExposure::exposed (const size_t facade, const double t) const
+{
+    const Sector &sector = sectors[facade];
+    double sinAltitude, azimuth;
+    altitudeAzimuth (sites[sector.site], sunOf (t), &sinAltitude, &azimuth);
+    return inside (sector, sinAltitude, azimuth);
+}
+
+size_t SunExposure::events (const time_t from, const time_t to, std::vector<SunFacadeEvent> &events,
+                            unsigned char *exposedAtStart) const
+{
+    struct Root
+    {
+        size_t site;
+        int    kind;
+        double value;
+        double time;
+    };
+
+    const size_t siteCount = sites.size (), facadeCount = sectors.size ();
+    std::vector<double> sinBefore (siteCount), azimuthBefore (siteCount), sinAfter (siteCount), azimuthAfter (siteCount);
+    std::vector<unsigned char> state (facadeCount);
+    std::vector<Root> roots;                  // of the current interval, shared by the facades of a site
+    std::vector<SunFacadeEvent> interval;     // events of the current interval, sorted before they are appended
+
+    double t0 = (double) from;
+    SunOfInstant sun = sunOf (t0);
+    for (size_t s = 0; s < siteCount; s++) altitudeAzimuth (sites[s], sun, &sinBefore[s], &azimuthBefore[s]);
+    for (size_t f = 0; f < facadeCount; f++)
+    {
+        const Sector &sector = sectors[f];
+        state[f] = inside (sector, sinBefore[sector.site], azimuthBefore[sector.site]);
+        if (exposedAtStart != nullptr) exposedAtStart[f] = state[f];
+    }
+
+    size_t found = 0;
+    while (t0 < (double) to)
+    {
+        double t1 = fmin (t0 + step, (double) to);
+        sun = sunOf (t1);
+        for (size_t s = 0; s < siteCount; s++) altitudeAzimuth (sites[s], sun, &sinAfter[s], &azimuthAfter[s]);
+
+        roots.clear ();
+        interval.clear ();
+        auto crossing = [&] (const size_t site, const int kind, const double value)
+        {
+            for (const Root &known : roots)
+                if (known.site == site && known.kind == kind && known.value == value) return known.time;
+            Root found = { site, kind, value, root (sites[site], kind, value, t0, t1) };
+            roots.push_back (found);
+            return found.time;
+        };
+
+        for (size_t f = 0; f < facadeCount; f++)
+        {
+            const Sector &sector = sectors[f];
+            const size_t s = sector.site;
+            bool now = inside (sector, sinAfter[s], azimuthAfter[s]);
+            if (now == (bool) state[f]) continue;
+
+            // The boundaries crossed within the interval
+            double times[3];
+            int count = 0;
+            if ((sinBefore[s] > sector.sinAltitude) != (sinAfter[s] > sector.sinAltitude))
+                times[count++] = crossing (s, cAltitude, sector.sinAltitude);
+            if (sector.width < 360.0)
+            {
+                double edges[2] = { sector.from, fmod (sector.from + sector.width, 360.0) };
+                for (double edge : edges)
+                    if (crossesAzimuth (rev180 (azimuthBefore[s] - edge), rev180 (azimuthAfter[s] - edge)))
+                        times[count++] = crossing (s, cAzimuth, edge);
+            }
+
+            SunFacadeEvent event;
+            event.facade = f;
+            if (count == 1)
+            {
+                event.time = times[0];
+                event.isEntry = now;
+                interval.push_back (event);
+            }
+            else
+            {
+                // Several boundaries (or, with the azimuth swinging, none that could be bracketed): the
+                // state just after each crossing decides, otherwise the end of the interval
+                for (int i = 1; i < count; i++)
+                    for (int j = i; j > 0 && times[j] < times[j - 1]; j--) std::swap (times[j], times[j - 1]);
+                bool current = state[f];
+                for (int i = 0; i < count; i++)
+                {
+                    bool after = exposed (f, times[i] + cTimeTolerance);
+                    if (after == current) continue;
+                    event.time = times[i];
+                    event.isEntry = after;
+                    interval.push_back (event);
+                    current = after;
+                }
+                if (current != now)
+                {
+                    event.time = t1;
+                    event.isEntry = now;
+                    interval.push_back (event);
+                }
+            }
+            state[f] = now;
+        }
+
+        std::sort (interval.begin (), interval.end (), [] (const SunFacadeEvent &a, const SunFacadeEvent &b)
+        {
+            return a.time != b.time ? a.time < b.time : a.facade < b.facade;
+        });
+        events.insert (events.end (), interval.begin (), interval.end ());
+        found += interval.size ();
+
+        sinBefore.swap (sinAfter);
+        azimuthBefore.swap (azimuthAfter);
+        t0 = t1;
+    }
+    return found;
+}
+
+size_t SunExposure::crossings (const double latitude, const double longitude, const double azimuth,
+                               const double minAltitude, const time_t from, const time_t to,
+                               std::vector<double> &times) const
+{
+    Site site;
+    site.sinLatitude = sind(latitude);
+    site.cosLatitude = cosd(latitude);
+    site.cosLongitude = cosd(longitude);
+    site.sinLongitude = sind(longitude);
+    const double sinMinimum = sind(minAltitude);
+
+    size_t found = 0;
+    double t0 = (double) from, sinBefore, azimuthBefore;
+    altitudeAzimuth (site, sunOf (t0), &sinBefore, &azimuthBefore);
+    while (t0 < (double) to)
+    {
+        double t1 = fmin (t0 + step, (double) to), sinAfter, azimuthAfter;
+        altitudeAzimuth (site, sunOf (t1), &sinAfter, &azimuthAfter);
+
+        if (crossesAzimuth (rev180 (azimuthBefore - azimuth), rev180 (azimuthAfter - azimuth))
+            && fmax (sinBefore, sinAfter) > sinMinimum)
+        {
+            double t = root (site, cAzimuth, azimuth, t0, t1);
+            double sinAltitude, at;
+            altitudeAzimuth (site, sunOf (t), &sinAltitude, &at);
+            if (sinAltitude > sinMinimum)
+            {
+                times.push_back (t);
+                found++;
+            }
+        }
+
+        sinBefore = sinAfter;
+        azimuthBefore = azimuthAfter;
+        t0 = t1;
+    }
+    return found;
+}
@@ -0,0 +1,174 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#pragma once
+
+#include <stddef.h>
+#include <time.h>
+#include <vector>
+
+#include "libsunwait.hpp"
+
+/**
+ * @brief A facade (or any surface) exposed to the sun within a sector of azimuth above an altitude
+ */
+struct SunFacade
+{
+    /// Geographical latitude in decimal degrees (N positive, S negative)
+    double latitude = DEFAULT_LATITUDE;
+    /// Geographical longitude in decimal degrees (E positive, W negative)
+    double longitude = DEFAULT_LONGITUDE;
+    /// Start of the sector, degrees from north through east; the sector runs clockwise to azimuthTo
+    double azimuthFrom = 0.0;
+    /// End of the sector, degrees from north through east. Equal to azimuthFrom for all azimuths
+    double azimuthTo = 0.0;
+    /// Lowest altitude of the sun's centre to count, degrees
+    double minAltitude = 0.0;
+
+    SunFacade() = default;
+    SunFacade(double lat, double lon, double from, double to, double altitude = 0.0)
+        : latitude{lat}, longitude{lon}, azimuthFrom{from}, azimuthTo{to}, minAltitude{altitude} {};
+};
+
+/**
+ * @brief The sun entering or leaving the sector of a facade
+ */
+struct SunFacadeEvent
+{
+    /// Time of the event, seconds since the epoch (with fraction)
+    double time;
+    /// Index of the facade in the facade set
+    size_t facade;
+    /// true when the sun enters the sector, false when it leaves
+    bool   isEntry;
+};
+
+/**
+ * @brief Sector entry and exit events of many facades
+ *
+ * Unlike the events of Sun::riset, which only depend on the hour angle, these depend on the sun's azimuth,
+ * which is evaluated with the sun's position taken at each instant (as SunTrack does). The sun is sampled at
+ * a fixed step; at each sample its position is computed once for all facades and its altitude and azimuth once
+ * per distinct site, so facades sharing a building cost one comparison each. Where a facade's state changes
+ * between samples, the boundary that was crossed (the altitude or either edge of the sector) is found by
+ * bracketed root finding, once per site and boundary.
+ *
+ * Excursions shorter than the step are missed: a sector narrower than the sun's motion in azimuth within
+ * the step, or the sun passing close to the zenith, where its azimuth swings quickly.
+ */
+class SunExposure
+{
+    public:
+    /**
+     * @brief Group the facades by site
+     *
+     * @param facades Facade set
+     * @param ephemeris Optional precomputed ephemeris, see SunWait::ephemeris
+     * @param stepSeconds Time between samples
+     */
+        SunExposure(const std::vector<SunFacade> &facades, const ChebyshevEphemeris *ephemeris = nullptr,
+                    const double stepSeconds = 600.0);
+
+    /**
+     * @brief Sector entries and exits of all facades within a time range
+     *
+     * @param from Start of the range, seconds since the epoch
+     * @param to End of the range
+     * @param events Output, appended in order of time
+     * @param exposedAtStart Optional output, one flag per facade: the sun in the sector at the start
+     * @return Number of events found
+     */
+        size_t events (const time_t from, const time_t to, std::vector<SunFacadeEvent> &events,
+                       unsigned char *exposedAtStart = nullptr) const;
+
+    /**
+     * @brief Times the sun crosses an azimuth while above an altitude
+     *
+     * @param latitude Geographical latitude in decimal degrees
+     * @param longitude Geographical longitude in decimal degrees
+     * @param azimuth Degrees from north through east
+     * @param minAltitude Lowest altitude of the sun's centre to count, degrees
+     * @param from Start of the range, seconds since the epoch
+     * @param to End of the range
+     * @param times Output, appended in order
+     * @return Number of crossings found
+     */
+        size_t crossings (const double latitude, const double longitude, const double azimuth, const double minAltitude,
+                          const time_t from, const time_t to, std::vector<double> &times) const;
+
+    /**
+     * @brief true if the sun is in the sector of the facade at the time
+     */
+        bool exposed (const size_t facade, const double t) const;
+
+    /**
+     * @brief The sun's position
+     *
+     * @param t Seconds since the epoch
+     * @param latitude Geographical latitude in decimal degrees
+     * @param longitude Geographical longitude in decimal degrees
+     * @param azimuth Output, degrees from north through east
+     * @param altitude Output, degrees (geometric, centre of the sun)
+     */
+        void position (const double t, const double latitude, const double longitude, double *azimuth,
+                       double *altitude) const;
+
+    private:
+        struct Site
+        {
+            double sinLatitude;
+            double cosLatitude;
+            double cosLongitude;
+            double sinLongitude;
+        };
+        struct Sector
+        {
+            size_t site;
+            double from;         // degrees
+            double width;        // degrees clockwise from 'from', 360 for all azimuths
+            double sinAltitude;  // of the lowest altitude
+        };
+        struct SunOfInstant
+        {
+            double sinDec;
+            double cosDec;
+            double cosHourAngle; // at Greenwich
+            double sinHourAngle;
+        };
+
+        SunOfInstant sunOf (const double t) const;
+        static void altitudeAzimuth (const Site &site, const SunOfInstant &sun, double *sinAltitude, double *azimuth);
+        static bool inside (const Sector &sector, const double sinAltitude, const double azimuth);
+        double root (const Site &site, const int kind, const double value, double lo, double hi) const;
+
+        std::vector<Site>   sites;
+        std::vector<Sector> sectors;   // per facade
+        const ChebyshevEphemeris *ephemeris;
+        double step;
+};
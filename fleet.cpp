@@ -0,0 +1,190 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <math.h>
+#include <algorithm>
+
+#include "fleet.hpp"
+#include "sun.hpp"
+#include "ephemeris.hpp"
+
+SunFleet::SunFleet(const std::vector<SunSite> &siteSet, const double bandWidth, const double maxErrorSeconds,
+                   const ChebyshevEphemeris *eph)
+    : sites{siteSet}, maxErrorHours{maxErrorSeconds / 3600.0}, ephemeris{eph}
+{
+    // Sort by twilight angle, then latitude band
+    std::vector<size_t> order (sites.size ());
+    std::vector<long>   bandOf (sites.size ());
+    for (size_t s = 0; s < sites.size (); s++)
+    {
+        order[s] = s;
+        bandOf[s] = (long) floor (sites[s].latitude / bandWidth);
+    }
+    std::sort (order.begin (), order.end (), [this, &bandOf] (size_t a, size_t b)
+    {
+        if (sites[a].twilightAngle != sites[b].twilightAngle) return sites[a].twilightAngle < sites[b].twilightAngle;
+        if (bandOf[a] != bandOf[b]) return bandOf[a] < bandOf[b];
+        return sites[a].latitude < sites[b].latitude;
+    });
+
+    for (size_t i = 0; i < order.size (); i++)
+    {
+        const SunSite &site = sites[order[i]];
+        if (i == 0 || bandOf[order[i]] != bandOf[order[i - 1]] || site.twilightAngle != sites[order[i - 1]].twilightAngle)
+        {
+            Band band;
+            band.latitude = (bandOf[order[i]] + 0.5) * bandWidth;
+            band.sinLatitude = sind(band.latitude);
+            band.cosLatitude = cosd(band.latitude);
+            band.twilightAngle = site.twilightAngle;
+            bandInfo.push_back (band);
+            bandFirst.push_back (i);
+        }
+        siteIndex.push_back (order[i]);
+        deltaLatitude.push_back (site.latitude - bandInfo.back ().latitude);
+        lonHours.push_back (site.longitude / 15.0);
+    }
+    bandFirst.push_back (order.size ());
+
+    // Sites are sorted by latitude within the bands: the first and last are the edges
+    for (size_t b = 0; b < bandInfo.size (); b++)
+    {
+        Band &band = bandInfo[b];
+        for (int edge = 0; edge < 2; edge++)
+        {
+            const SunSite &site = sites[siteIndex[edge == 0 ? bandFirst[b] : bandFirst[b + 1] - 1]];
+            band.sinEdge[edge] = sind(site.latitude);
+            band.cosEdge[edge] = cosd(site.latitude);
+            band.deltaEdge[edge] = site.latitude - band.latitude;
+        }
+    }
+}
+
+void SunFleet::riset (const unsigned long daysSince2000, SunArc *arcs) const
+{
+    // Everything about the sun itself is shared by all bands
+    double sra, sdec, sr;
+    double day = (double) (long) daysSince2000 + 1.5; // Noon UTC of the day (days before 2000 too), as in Sun::riset
+    if (ephemeris != nullptr && ephemeris->covers (day))
+        ephemeris->sun_RA_dec (day, &sra, &sdec, &sr);
+    else
+        Sun::sun_RA_dec (day, &sra, &sdec, &sr);
+
+    double siderealTime = Sun::GMST0 (day) + 180.0;
+    double y = fmod (siderealTime - sra, 360.0);
+    if (y < 0.0) y += 360.0;
+    if (y > 180.0) y -= 360.0;
+    double southHourGreenwich = 12.0 - y / 15.0;
+
+    double sinDec = sind(sdec);
+    double cosDec = cosd(sdec);
+    double sradius = 0.2666 / sr;
+
+    for (size_t b = 0; b + 1 < bandFirst.size (); b++)
+    {
+        const Band &band = bandInfo[b];
+        double altitude = band.twilightAngle == TWILIGHT_ANGLE_DAYLIGHT ? band.twilightAngle - sradius : band.twilightAngle;
+        double sinAltitude = sind(altitude);
+
+        double cost = (sinAltitude - band.sinLatitude * sinDec) / (band.cosLatitude * cosDec);
+        double sinH = sqrt (fmax (0.0, 1.0 - cost * cost));
+
+        // Diurnal arc of the band centre, and its derivative with respect to latitude (hours per degree):
+        //     dH/dlat = (sin dec - sin h sin lat) / (cos^2 lat cos dec sin H)
+        bool linear = sinH > 0.0;
+        double diurnalArc = 0.0, dArcdLat = 0.0;
+        if (linear)
+        {
+            diurnalArc = 2.0 * acosd(cost) / 15.0;
+            dArcdLat = 2.0 / 15.0 * (sinDec - sinAltitude * band.sinLatitude)
+                       / (band.cosLatitude * band.cosLatitude * cosDec * sinH);
+        }
+
+        // The error of the correction grows with the distance from the centre: check the edges
+        for (int edge = 0; edge < 2 && linear; edge++)
+        {
+            double costEdge = (sinAltitude - band.sinEdge[edge] * sinDec) / (band.cosEdge[edge] * cosDec);
+            if (costEdge <= -1.0 || costEdge >= 1.0)
+                linear = false;
+            else
+                linear = fabs (diurnalArc + dArcdLat * band.deltaEdge[edge] - 2.0 * acosd(costEdge) / 15.0)
+                         <= 2.0 * maxErrorHours;
+        }
+
+        if (!linear)
+        {
+            // Poor linear correction, or close to polar day or night: exact for each site
+            for (size_t i = bandFirst[b]; i < bandFirst[b + 1]; i++)
+            {
+                const SunSite &site = sites[siteIndex[i]];
+                Sun sun(site.longitude, site.latitude, site.twilightAngle);
+                sun.ephemeris = ephemeris;
+                arcs[siteIndex[i]] = sun.riset (daysSince2000);
+            }
+            continue;
+        }
+
+        for (size_t i = bandFirst[b]; i < bandFirst[b + 1]; i++)
+        {
+            double southHour = southHourGreenwich - lonHours[i];
+            if (southHour <   0.0) southHour += 24.0;
+            if (southHour >= 24.0) southHour -= 24.0;
+
+            double arc = diurnalArc + dArcdLat * deltaLatitude[i];
+            if (arc > 24.0) arc = 24.0;
+            if (arc <  0.0) arc =  0.0;
+
+            arcs[siteIndex[i]] = SunArc(arc, southHour);
+        }
+    }
+}
+
+double SunFleet::maxError (const unsigned long daysSince2000, const int days) const
+{
+    std::vector<SunArc> arcs (sites.size (), SunArc(0.0, 0.0));
+    double maxDifference = 0.0;
+
+    for (int d = 0; d < days; d++)
+    {
+        riset (daysSince2000 + d, arcs.data ());
+        for (size_t s = 0; s < sites.size (); s++)
+        {
+            Sun sun(sites[s].longitude, sites[s].latitude, sites[s].twilightAngle);
+            sun.ephemeris = ephemeris;
+            SunArc exact = sun.riset (daysSince2000 + d);
+
+            double riseDifference = fabs (arcs[s].getOffsetRiseHourUTC (NO_OFFSET) - exact.getOffsetRiseHourUTC (NO_OFFSET));
+            double setDifference  = fabs (arcs[s].getOffsetSetHourUTC  (NO_OFFSET) - exact.getOffsetSetHourUTC  (NO_OFFSET));
+            // The south hour may have wrapped differently by a whole day
+            riseDifference = fmin (riseDifference, fabs (riseDifference - 24.0));
+            setDifference  = fmin (setDifference,  fabs (setDifference  - 24.0));
+            maxDifference = fmax (maxDifference, 3600.0 * fmax (riseDifference, setDifference));
+        }
+    }
+    return maxDifference;
+}
@@ -0,0 +1,105 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "libsunwait.hpp"
+#include "sunarc.hpp"
+
+/**
+ * @brief Sun arcs of many sites, computed per latitude band
+ *
+ * For a given day the sun's declination and right ascension are the same for all sites, and the
+ * south hour depends on the longitude only through a shift of 4 minutes per degree. The sites are
+ * therefore sorted into latitude bands (per twilight angle), the diurnal arc and its derivative with
+ * respect to latitude are computed once per band and day, and each site's arc follows from the band's
+ * by a longitude shift and a first order latitude correction. The work per site is a few multiply-adds
+ * instead of the trigonometric functions of Sun::riset.
+ *
+ * Each day the correction is checked against the exact arcs at the northern and southern-most site of each
+ * band. Bands where it is off by more than the error bound (this happens near the polar circles, where
+ * the arc changes rapidly with latitude) and bands turning into polar day or night are computed exactly
+ * per site. Use maxError() to check the error against Sun::riset.
+ */
+class SunFleet
+{
+    public:
+    /**
+     * @brief Sort the sites into latitude bands
+     *
+     * @param sites Site set (the offsets of the sites are not used: apply them to the returned arcs)
+     * @param bandWidth Width of the latitude bands in degrees
+     * @param maxErrorSeconds Error bound of the rise and set times for the latitude correction
+     * @param ephemeris Optional precomputed ephemeris, see SunWait::ephemeris
+     */
+        SunFleet(const std::vector<SunSite> &sites, const double bandWidth = 0.25, const double maxErrorSeconds = 1.0,
+                 const ChebyshevEphemeris *ephemeris = nullptr);
+
+    /**
+     * @brief Sun arcs of all sites for one day
+     *
+     * @param daysSince2000 Day of the request
+     * @param arcs Output, one arc per site in the order of the site set
+     */
+        void riset (const unsigned long daysSince2000, SunArc *arcs) const;
+
+    /**
+     * @brief Largest difference of the rise and set times from Sun::riset
+     *
+     * @param daysSince2000 First day checked
+     * @param days Number of days checked
+     * @return The largest difference found, in seconds
+     */
+        double maxError (const unsigned long daysSince2000, const int days = 1) const;
+
+    /// Number of latitude bands holding sites
+        size_t bands () const { return bandFirst.size () - 1; }
+
+    private:
+        struct Band
+        {
+            double latitude;      // centre of the band
+            double sinLatitude;
+            double cosLatitude;
+            double twilightAngle;
+            double sinEdge[2];    // of the southern and northern-most site, for the error check
+            double cosEdge[2];
+            double deltaEdge[2];
+        };
+
+        std::vector<SunSite> sites;
+        std::vector<Band>    bandInfo;
+        std::vector<size_t>  bandFirst;   // index into the sorted arrays of the first site of each band, plus the end
+        std::vector<size_t>  siteIndex;   // sorted position -> index in the site set
+        std::vector<double>  deltaLatitude;
+        std::vector<double>  lonHours;
+        double maxErrorHours;
+        const ChebyshevEphemeris *ephemeris;
+};
@@ -0,0 +1,237 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <string.h>
+#include <algorithm>
+
+#include "formatter.hpp"
+
+static const char cDigitPairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+inline char *putTwoDigits (char *p, const unsigned value)
+{
+    memcpy (p, cDigitPairs + 2 * value, 2);
+    return p + 2;
+}
+
+/*
+** Civil date from days since 1970-01-01 (proleptic Gregorian calendar)
+*/
+inline void civilFromDays (long z, long *y, unsigned *m, unsigned *d)
+{
+    z += 719468;
+    const long era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = (unsigned) (z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    *d = doy - (153 * mp + 2) / 5 + 1;
+    *m = mp < 10 ? mp + 3 : mp - 9;
+    *y = (long) yoe + era * 400 + (*m <= 2);
+}
+
+inline long daysFromCivil (long y, const unsigned m, const unsigned d)
+{
+    y -= m <= 2;
+    const long era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = (unsigned) (y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (long) doe - 719468;
+}
+
+/*
+** Offset of the local timezone at t, from the broken down local time
+** (tm_gmtoff is not available everywhere)
+*/
+static long localOffset (const time_t t)
+{
+    struct tm localTm;
+#if defined _WIN32 || defined _WIN64
+    localtime_s (&localTm, &t);
+#else
+    localtime_r (&t, &localTm);
+#endif
+    long long localSeconds = (long long) daysFromCivil (localTm.tm_year + 1900, localTm.tm_mon + 1, localTm.tm_mday) * 86400
+                             + localTm.tm_hour * 3600 + localTm.tm_min * 60 + localTm.tm_sec;
+    return (long) (localSeconds - (long long) t);
+}
+
+UtcOffsetTable::UtcOffsetTable()
+{
+    offsets.push_back (0);
+}
+
+UtcOffsetTable::UtcOffsetTable(const time_t from, const time_t to)
+{
+    // Sample twice a day; where the offset changes, find the exact second by bisection.
+    // Timezones don't change their offset more than once within 12 hours.
+    const time_t step = 12 * 3600;
+    time_t previousTime = from;
+    long previousOffset = localOffset (from);
+    offsets.push_back (previousOffset);
+
+    for (time_t t = from + step; ; t += step)
+    {
+        if (t > to) t = to;
+        long thisOffset = localOffset (t);
+        if (thisOffset != previousOffset)
+        {
+            time_t low = previousTime, high = t; // offset(low) = previous, offset(high) = this
+            while (high - low > 1)
+            {
+                time_t middle = low + (high - low) / 2;
+                if (localOffset (middle) == previousOffset) low = middle;
+                else high = middle;
+            }
+            changes.push_back (high);
+            offsets.push_back (thisOffset);
+            previousOffset = thisOffset;
+        }
+        previousTime = t;
+        if (t >= to) break;
+    }
+}
+
+long UtcOffsetTable::offset (const time_t t) const
+{
+    size_t i = std::upper_bound (changes.begin (), changes.end (), t) - changes.begin ();
+    return offsets[i];
+}
+
+size_t formatTime (char *out, const time_t t, const TimeFormat format, const long offsetSeconds)
+{
+    char *p = out;
+
+    if (format == TIME_FORMAT_EPOCH)
+    {
+        char digits[24];
+        char *q = digits + sizeof (digits);
+        bool negative = t < 0;
+        unsigned long long v = negative ? 0ULL - (unsigned long long) t : (unsigned long long) t;
+        do
+        {
+            *--q = (char) ('0' + v % 10);
+            v /= 10;
+        }
+        while (v != 0);
+        if (negative) *--q = '-';
+        size_t length = digits + sizeof (digits) - q;
+        memcpy (p, q, length);
+        return length;
+    }
+
+    long long local = (long long) t + offsetSeconds;
+    long long days = local >= 0 ? local / 86400 : (local - 86399) / 86400;
+    unsigned secondsOfDay = (unsigned) (local - days * 86400);
+    unsigned hour = secondsOfDay / 3600;
+    unsigned minute = secondsOfDay / 60 % 60;
+    unsigned second = secondsOfDay % 60;
+
+    if (format == TIME_FORMAT_HHMM)
+    {
+        p = putTwoDigits (p, hour);
+        *p++ = ':';
+        p = putTwoDigits (p, minute);
+        return p - out;
+    }
+
+    long year;
+    unsigned month, day;
+    civilFromDays ((long) days, &year, &month, &day);
+    if (year < 0 || year > 9999) year = year < 0 ? 0 : 9999;
+    p = putTwoDigits (p, (unsigned) (year / 100));
+    p = putTwoDigits (p, (unsigned) (year % 100));
+    *p++ = '-';
+    p = putTwoDigits (p, month);
+    *p++ = '-';
+    p = putTwoDigits (p, day);
+    *p++ = 'T';
+    p = putTwoDigits (p, hour);
+    *p++ = ':';
+    p = putTwoDigits (p, minute);
+    *p++ = ':';
+    p = putTwoDigits (p, second);
+    if (offsetSeconds == 0)
+        *p++ = 'Z';
+    else
+    {
+        long absolute = offsetSeconds < 0 ? -offsetSeconds : offsetSeconds;
+        *p++ = offsetSeconds < 0 ? '-' : '+';
+        p = putTwoDigits (p, (unsigned) (absolute / 3600 % 100));
+        *p++ = ':';
+        p = putTwoDigits (p, (unsigned) (absolute / 60 % 60));
+    }
+    return p - out;
+}
+
+EventWriter::EventWriter(FILE *outputFile, const TimeFormat timeFormat, const UtcOffsetTable *timezone,
+                         const size_t bufferSize)
+    : file{outputFile}, format{timeFormat}, zone{timezone}, buffer(std::max (bufferSize, (size_t) 4 * FORMAT_TIME_MAX))
+{
+}
+
+EventWriter::~EventWriter()
+{
+    flush ();
+}
+
+void EventWriter::time (const time_t t)
+{
+    reserve (FORMAT_TIME_MAX);
+    used += formatTime (&buffer[used], t, format, zone != nullptr ? zone->offset (t) : 0);
+}
+
+void EventWriter::text (const char *s)
+{
+    size_t length = strlen (s);
+    while (length > 0)
+    {
+        reserve (1);
+        size_t chunk = std::min (length, buffer.size () - used);
+        memcpy (&buffer[used], s, chunk);
+        used += chunk;
+        s += chunk;
+        length -= chunk;
+    }
+}
+
+void EventWriter::character (const char c)
+{
+    reserve (1);
+    buffer[used++] = c;
+}
+
+void EventWriter::flush ()
+{
+    if (used > 0) fwrite (buffer.data (), 1, used, file);
+    used = 0;
+}
@@ -0,0 +1,141 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <time.h>
+#include <cstdio>
+#include <vector>
+
+/**
+ * @brief Output formats of EventWriter and formatTime
+ */
+typedef enum
+{
+    /// 24 hour clock, minutes truncated: 05:32
+    TIME_FORMAT_HHMM
+    /// ISO 8601 with the UTC offset: 2024-06-01T05:32:10Z or 2024-06-01T07:32:10+02:00
+    , TIME_FORMAT_ISO8601
+    /// Seconds since the epoch: 1717219930
+    , TIME_FORMAT_EPOCH
+} TimeFormat;
+
+/// Longest output of formatTime, in bytes
+#define FORMAT_TIME_MAX 32
+
+/**
+ * @brief Precomputed UTC offsets of the local timezone
+ *
+ * The offsets (and the times they change, for daylight saving) are looked up once for a range of times,
+ * after which converting a time to local time is a table lookup instead of a call to localtime_r.
+ * Times outside the range use the offset of the nearest end.
+ */
+class UtcOffsetTable
+{
+    public:
+    /**
+     * @brief A table for UTC: the offset is always zero
+     */
+        UtcOffsetTable();
+
+    /**
+     * @brief A table for the local timezone (TZ) between two times
+     *
+     * @param from Start of the range
+     * @param to End of the range
+     */
+        UtcOffsetTable(const time_t from, const time_t to);
+
+    /**
+     * @brief Offset of local time from UTC in seconds (east positive)
+     *
+     * @param t Time
+     */
+        long offset (const time_t t) const;
+
+    private:
+        std::vector<time_t> changes;   // times from which offsets[i + 1] applies
+        std::vector<long>   offsets;
+};
+
+/**
+ * @brief Format a time into a caller-supplied buffer
+ *
+ * No locale or timezone functions of the C library are used.
+ *
+ * @param out Output, at least FORMAT_TIME_MAX bytes. It is not null terminated.
+ * @param t Time
+ * @param format Output format
+ * @param offsetSeconds Offset from UTC of the timezone to print (e.g. from UtcOffsetTable::offset)
+ * @return Number of bytes written
+ */
+size_t formatTime (char *out, const time_t t, const TimeFormat format, const long offsetSeconds = 0);
+
+/**
+ * @brief Buffered writer of formatted event times
+ *
+ * Text and times are collected in a large buffer and handed to the FILE in one fwrite per buffer,
+ * instead of one printf (and one stdio lock) per value. Call flush() before writing to the same FILE
+ * by other means; the destructor flushes, too.
+ */
+class EventWriter
+{
+    public:
+    /**
+     * @brief Construct a writer
+     *
+     * @param file Output file (e.g. stdout)
+     * @param format Output format of times
+     * @param zone Timezone offsets, UTC when nullptr. It is not owned by the writer.
+     * @param bufferSize Size of the buffer in bytes
+     */
+        EventWriter(FILE *file, const TimeFormat format, const UtcOffsetTable *zone = nullptr,
+                    const size_t bufferSize = 1 << 16);
+        ~EventWriter();
+
+    /// Append a formatted time
+        void time (const time_t t);
+    /// Append text
+        void text (const char *s);
+    /// Append a character
+        void character (const char c);
+    /// Write the buffer to the file
+        void flush ();
+
+    private:
+        FILE *file;
+        TimeFormat format;
+        const UtcOffsetTable *zone;
+        std::vector<char> buffer;
+        size_t used = 0;
+
+        void reserve (const size_t bytes)
+        {
+            if (used + bytes > buffer.size ()) flush ();
+        }
+};
@@ -0,0 +1,258 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <utility>
+
+#include "horizon.hpp"
+#include "sun.hpp"
+#include "ephemeris.hpp"
+#include "root.hpp"
+
+static const double cAzimuthStep = 0.25;         // grid of the terrain profile, degrees
+static const int    cAzimuthCells = 1440;
+static const double cDeclinationMin = -23.5;     // rows of the hour angle table, degrees
+static const double cDeclinationStep = 0.05;
+static const int    cDeclinationRows = 941;
+static const double cScanStep = 0.5;             // hour angle steps of the search along a path, degrees
+static const double cMaxJump = 0.5;              // largest hour angle change between rows to interpolate, degrees
+static const double cSunRadius = 0.2666;         // apparent radius at one astronomical unit, degrees
+static const double cHourAngleTolerance = 1e-5;  // degrees, about 2 ms
+static const int    cMaxIterations = 60;
+
+SunHorizon::SunHorizon(const double lat, const double lon, const double elevation, const ChebyshevEphemeris *eph)
+    : latitude{lat}, longitude{lon}, sinLatitude{sind(lat)}, cosLatitude{cosd(lat)},
+      dipAngle{elevation > 0.0 ? 1.76 / 60.0 * sqrt (elevation) : 0.0}, terrain(cAzimuthCells, 0.0f),
+      ephemeris{eph}
+{
+    tabulate ();
+}
+
+void SunHorizon::setProfile (const double *azimuths, const double *altitudes, const size_t count)
+{
+    std::vector<std::pair<double, double> > points;
+    for (size_t i = 0; i < count; i++)
+        points.push_back (std::make_pair (fmod (fmod (azimuths[i], 360.0) + 360.0, 360.0), altitudes[i]));
+    std::sort (points.begin (), points.end ());
+
+    // Resample on the grid, interpolating linearly between the points (across north as well)
+    for (int cell = 0; cell < cAzimuthCells; cell++)
+    {
+        if (points.empty ())
+        {
+            terrain[cell] = 0.0f;
+            continue;
+        }
+        double azimuth = cell * cAzimuthStep;
+        size_t next = std::lower_bound (points.begin (), points.end (), std::make_pair (azimuth, -1e9)) - points.begin ();
+        const std::pair<double, double> &after = next < points.size () ? points[next] : points.front ();
+        const std::pair<double, double> &before = next > 0 ? points[next - 1] : points.back ();
+        double span = fmod (after.first - before.first + 360.0, 360.0);
+        double offset = fmod (azimuth - before.first + 360.0, 360.0);
+        terrain[cell] = (float) (span > 0.0 ? before.second + (after.second - before.second) * offset / span : before.second);
+    }
+    tabulate ();
+}
+
+bool SunHorizon::loadProfile (const char *path)
+{
+    FILE *file = fopen (path, "r");
+    if (file == nullptr)
+    {
+        printf ("Error: Couldn't open horizon profile %s.\n", path);
+        return false;
+    }
+
+    std::vector<double> azimuths, altitudes;
+    char line[256];
+    int lineNumber = 0;
+    bool ok = true;
+    while (ok && fgets (line, sizeof (line), file) != nullptr)
+    {
+        lineNumber++;
+        const char *text = line;
+        while (*text == ' ' || *text == '\t') text++;
+        if (*text == '#' || *text == '\n' || *text == '\r' || *text == '\0') continue;
+
+        double azimuth, altitude;
+        ok = sscanf (text, "%lf %lf", &azimuth, &altitude) == 2 && altitude > -90.0 && altitude < 90.0;
+        if (!ok) printf ("Error: Invalid point in line %d of horizon profile %s.\n", lineNumber, path);
+        azimuths.push_back (azimuth);
+        altitudes.push_back (altitude);
+    }
+    fclose (file);
+    if (!ok) return false;
+
+    setProfile (azimuths.data (), altitudes.data (), azimuths.size ());
+    return true;
+}
+
+double SunHorizon::horizonAltitude (const double azimuth) const
+{
+    if (!isfinite (azimuth)) return NAN;
+
+    double position = fmod (fmod (azimuth, 360.0) + 360.0, 360.0) / cAzimuthStep;
+    int cell = (int) position;
+    if (cell >= cAzimuthCells) cell = 0;
+    double fraction = position - cell;
+    double next = terrain[cell + 1 < cAzimuthCells ? cell + 1 : 0];
+    return terrain[cell] + (next - terrain[cell]) * fraction - dipAngle;
+}
+
+/*
+** Altitude of the sun's upper limb above the horizon at an hour angle, for a fixed declination:
+**     sin h = sin lat sin dec + cos lat cos dec cos H
+**     tan A = -cos dec sin H / (sin dec cos lat - cos dec cos H sin lat)
+** The limb is that of TWILIGHT_ANGLE_DAYLIGHT in Sun::riset, at the mean distance of the sun.
+*/
+double SunHorizon::pathAltitude (const double sinDec, const double cosDec, const double hourAngle) const
+{
+    double sinH = sind(hourAngle), cosH = cosd(hourAngle);
+    double sinAltitude = sinLatitude * sinDec + cosLatitude * cosDec * cosH;
+    double altitude = asind(fmax (fmin (sinAltitude, 1.0), -1.0));
+    double azimuth = atan2d(-cosDec * sinH, sinDec * cosLatitude - cosDec * cosH * sinLatitude);
+    return altitude - (TWILIGHT_ANGLE_DAYLIGHT) + cSunRadius - horizonAltitude (azimuth);
+}
+
+/* Hour angle between lo and hi, which bracket a crossing */
+double SunHorizon::crossing (const double sinDec, const double cosDec, const double lo, const double hi) const
+{
+    auto path = [this, sinDec, cosDec] (const double hourAngle) { return pathAltitude (sinDec, cosDec, hourAngle); };
+    return illinoisRoot (path, lo, path (lo), hi, path (hi), cHourAngleTolerance, cMaxIterations);
+}
+
+/*
+** Hour angles of rise and set along the path of one declination: the first crossing upwards from -180
+** degrees and the last one downwards before +180. A sun up at midnight rises at -180 or sets at +180;
+** one which never comes up rises and sets at 0.
+** The change of the hour angles with the altitude of the sun's limb (for its distance) is returned as well,
+** zero where there is no crossing.
+*/
+void SunHorizon::crossings (const double declination, double *rise, double *set, double *riseShift,
+                            double *setShift) const
+{
+    const double sinDec = sind(declination), cosDec = cosd(declination);
+    const int steps = (int) (360.0 / cScanStep);
+
+    *rise = 0.0;
+    *set = 0.0;
+    bool riseFound = false;
+    double before = pathAltitude (sinDec, cosDec, -180.0);
+    if (before > 0.0)
+    {
+        *rise = -180.0;
+        riseFound = true;
+    }
+    for (int i = 1; i <= steps; i++)
+    {
+        double hourAngle = -180.0 + i * cScanStep;
+        double after = pathAltitude (sinDec, cosDec, hourAngle);
+        if (before <= 0.0 && after > 0.0 && !riseFound)
+        {
+            *rise = crossing (sinDec, cosDec, hourAngle - cScanStep, hourAngle);
+            riseFound = true;
+        }
+        if (before > 0.0 && after <= 0.0) *set = crossing (sinDec, cosDec, hourAngle - cScanStep, hourAngle);
+        if (i == steps && after > 0.0) *set = 180.0;
+        before = after;
+    }
+
+    // Raising the path by dh moves a crossing by -dh / (df/dH)
+    const double h = 1e-3;
+    *riseShift = 0.0;
+    *setShift = 0.0;
+    if (*rise > -180.0 && *rise < 180.0 && *rise != *set)
+    {
+        double slope = (pathAltitude (sinDec, cosDec, *rise + h) - pathAltitude (sinDec, cosDec, *rise - h)) / (2.0 * h);
+        if (slope > 0.0) *riseShift = -1.0 / slope;
+    }
+    if (*set > -180.0 && *set < 180.0 && *rise != *set)
+    {
+        double slope = (pathAltitude (sinDec, cosDec, *set + h) - pathAltitude (sinDec, cosDec, *set - h)) / (2.0 * h);
+        if (slope < 0.0) *setShift = -1.0 / slope;
+    }
+}
+
+void SunHorizon::tabulate ()
+{
+    morning.resize (cDeclinationRows);
+    evening.resize (cDeclinationRows);
+    morningShift.resize (cDeclinationRows);
+    eveningShift.resize (cDeclinationRows);
+    for (int row = 0; row < cDeclinationRows; row++)
+        crossings (cDeclinationMin + row * cDeclinationStep, &morning[row], &evening[row], &morningShift[row],
+                   &eveningShift[row]);
+}
+
+SunHorizonDay SunHorizon::riset (const unsigned long daysSince2000) const
+{
+    // The sun's position and the south hour as in Sun::riset, at noon UTC of the day; days before 2000 wrap
+    // around to large values
+    const double d = (double) (long) daysSince2000 + 1.5;
+    double sra, sdec, sr;
+    if (ephemeris != nullptr && ephemeris->covers (d))
+        ephemeris->sun_RA_dec (d, &sra, &sdec, &sr);
+    else
+        Sun::sun_RA_dec (d, &sra, &sdec, &sr);
+    double angle = Sun::GMST0 (d) + 180.0 + longitude - sra;
+    angle -= 360.0 * ceil ((angle - 180.0) / 360.0);   // -180 < angle <= 180
+    double southHour = 12.0 - angle / 15.0;
+
+    // Interpolate quadratically over the three rows nearest the declination, unless the crossing jumps
+    // between them
+    double rise, set, riseShift, setShift;
+    double position = (sdec - cDeclinationMin) / cDeclinationStep;
+    int row = (int) floor (position + 0.5);
+    if (row >= 1 && row + 1 < cDeclinationRows
+        && fabs (morning[row + 1] - morning[row]) <= cMaxJump && fabs (morning[row] - morning[row - 1]) <= cMaxJump
+        && fabs (evening[row + 1] - evening[row]) <= cMaxJump && fabs (evening[row] - evening[row - 1]) <= cMaxJump)
+    {
+        double x = position - row;   // -0.5 .. 0.5
+        rise = morning[row] + x * (morning[row + 1] - morning[row - 1]) / 2.0
+               + x * x * (morning[row + 1] - 2.0 * morning[row] + morning[row - 1]) / 2.0;
+        set = evening[row] + x * (evening[row + 1] - evening[row - 1]) / 2.0
+              + x * x * (evening[row + 1] - 2.0 * evening[row] + evening[row - 1]) / 2.0;
+        riseShift = morningShift[row] + x * (morningShift[row + 1] - morningShift[row - 1]) / 2.0;
+        setShift = eveningShift[row] + x * (eveningShift[row + 1] - eveningShift[row - 1]) / 2.0;
+    }
+    else
+        crossings (sdec, &rise, &set, &riseShift, &setShift);
+
+    // The table is for the sun at one astronomical unit: correct for its apparent radius on the day
+    double radiusChange = cSunRadius / sr - cSunRadius;
+    rise += riseShift * radiusChange;
+    set += setShift * radiusChange;
+
+    SunHorizonDay day;
+    day.riseHourUTC = southHour + rise / 15.0;
+    day.setHourUTC = southHour + set / 15.0;
+    return day;
+}
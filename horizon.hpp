@@ -0,0 +1,136 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include "libsunwait.hpp"
+
+/**
+ * @brief Sun rise and set over the terrain, as hours UTC
+ *
+ * When the sun doesn't rise over the terrain all day, both are the time it is south. When it doesn't set
+ * (nor dip behind the terrain), they are that time minus and plus 12 hours: the conventions of Sun::riset.
+ */
+struct SunHorizonDay
+{
+    /// First appearance of the sun's upper limb over the horizon
+    double riseHourUTC;
+    /// Last disappearance of the sun's upper limb behind the horizon
+    double setHourUTC;
+};
+
+/**
+ * @brief Sun rise and set for an elevated observer with a terrain horizon
+ *
+ * The horizon is the dip below the mathematical horizon for the observer's elevation (1.76 arc minutes times
+ * the square root of the elevation in metres, refraction included) plus an azimuth-indexed profile of the
+ * terrain's altitude, interpolated linearly between the given points. Rise is the first time of the day the
+ * sun's upper limb comes over it, set the last time it goes behind it (the sun may disappear behind a
+ * peak in between).
+ *
+ * As in Sun::riset the sun's declination is taken once per day, so its path over the sky only depends on the
+ * declination. The hour angles where the path meets the horizon are tabulated over the declinations of the
+ * year when the profile is set, and a day's rise and set are interpolated from the table. This costs about
+ * as much as Sun::riset. Where the path grazes a peak (the hour angle jumps between neighbouring rows of the
+ * table), the crossing is searched on the day's path instead.
+ */
+class SunHorizon
+{
+    public:
+    /**
+     * @brief Observer without terrain (dip only)
+     *
+     * @param latitude Geographical latitude in decimal degrees
+     * @param longitude Geographical longitude in decimal degrees
+     * @param elevation Height above the surrounding terrain or sea, metres
+     * @param ephemeris Optional precomputed ephemeris, see SunWait::ephemeris
+     */
+        SunHorizon(const double latitude, const double longitude, const double elevation = 0.0,
+                   const ChebyshevEphemeris *ephemeris = nullptr);
+
+    /**
+     * @brief Set the terrain profile
+     *
+     * @param azimuths Degrees from north through east, in any order
+     * @param altitudes Altitude of the terrain at each azimuth, degrees
+     * @param count Number of points; none for a flat horizon
+     */
+        void setProfile (const double *azimuths, const double *altitudes, const size_t count);
+
+    /**
+     * @brief Load the terrain profile from a text file
+     *
+     * One point per line: azimuth and altitude in degrees, separated by white space. Empty lines and
+     * lines starting with # are skipped.
+     *
+     * @param path File name
+     * @return Return true when successful. The profile is left unchanged otherwise.
+     */
+        bool loadProfile (const char *path);
+
+    /**
+     * @brief Rise and set over the terrain
+     *
+     * @param daysSince2000 Day of the request
+     */
+        SunHorizonDay riset (const unsigned long daysSince2000) const;
+
+    /**
+     * @brief Altitude of the horizon, degrees: the terrain minus the dip
+     *
+     * @param azimuth Degrees from north through east
+     * @return The altitude, or NaN when the azimuth is not finite
+     */
+        double horizonAltitude (const double azimuth) const;
+
+    /// Dip of the horizon for the observer's elevation, degrees
+        double dip () const { return dipAngle; }
+
+    private:
+        double crossing (const double sinDec, const double cosDec, const double lo, const double hi) const;
+        void   crossings (const double declination, double *rise, double *set, double *riseShift,
+                          double *setShift) const;
+        double pathAltitude (const double sinDec, const double cosDec, const double hourAngle) const;
+        void   tabulate ();
+
+        double latitude;
+        double longitude;
+        double sinLatitude;
+        double cosLatitude;
+        double dipAngle;
+        std::vector<float>  terrain;    // altitude on a regular grid of azimuths
+        std::vector<double> morning;    // hour angle of rise per row of declination, degrees
+        std::vector<double> evening;    // hour angle of set
+        std::vector<double> morningShift;   // change of the hour angles with the altitude of the limb
+        std::vector<double> eveningShift;
+        const ChebyshevEphemeris *ephemeris;
+};
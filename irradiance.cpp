@@ -0,0 +1,116 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#include <math.h>
+
+#include "irradiance.hpp"
+#include "sun.hpp"
+#include "ephemeris.hpp"
+
+SunIrradiance::SunIrradiance(const std::vector<SunPlant> &plants, const SunClearSkyModel model,
+                             const ChebyshevEphemeris *eph)
+    : terms(plants.size ()), clearSky{model}, ephemeris{eph}
+{
+    for (size_t p = 0; p < plants.size (); p++)
+    {
+        const SunPlant &plant = plants[p];
+        PlantTerms &term = terms[p];
+        term.sinLatitude = sind(plant.latitude);
+        term.cosLatCosLon = cosd(plant.latitude) * cosd(plant.longitude);
+        term.cosLatSinLon = cosd(plant.latitude) * sind(plant.longitude);
+
+        // Ineichen and Perez (2002), with the absolute air mass from the pressure at the elevation
+        double h = plant.elevation;
+        double fh1 = exp (-h / 8000.0);
+        double fh2 = exp (-h / 1250.0);
+        term.pressure = exp (-h / 8434.5);
+        term.cg1 = 5.09E-5 * h + 0.868;
+        term.attenuation = (3.92E-5 * h + 0.0387) * (fh1 + fh2 * (plant.linkeTurbidity - 1.0));
+    }
+}
+
+double SunIrradiance::airMass (const double altitude)
+{
+    if (altitude <= 0.0) return 0.0;
+    return 1.0 / (sind(altitude) + 0.50572 * pow (altitude + 6.07995, -1.6364));
+}
+
+SunIrradiance::SunOfInstant SunIrradiance::sunOf (const double t) const
+{
+    // Hour angle at Greenwich; a plant's adds its longitude
+    double dec, r, hourAngle;
+    sunAtInstant (ephemeris, t, &dec, &r, &hourAngle);
+
+    SunOfInstant sun;
+    sun.sinDec = sind(dec);
+    sun.cosDec = cosd(dec);
+    sun.cosHourAngle = cosd(hourAngle);
+    sun.sinHourAngle = sind(hourAngle);
+    sun.extraterrestrial = extraterrestrial (r);
+    return sun;
+}
+
+double SunIrradiance::model (const PlantTerms &plant, const SunOfInstant &sun, const double sinAltitude) const
+{
+    if (sinAltitude <= 0.0) return 0.0;
+    if (clearSky == SUN_CLEAR_SKY_HAURWITZ) return 1098.0 * sinAltitude * exp (-0.059 / sinAltitude);
+
+    double absoluteAirMass = airMass (asind(sinAltitude)) * plant.pressure;
+    return plant.cg1 * sun.extraterrestrial * sinAltitude
+           * exp (-plant.attenuation * absoluteAirMass + 0.01 * pow (absoluteAirMass, 1.8));
+}
+
+void SunIrradiance::ghi (const time_t start, const int stepSeconds, const int slots, float *irradiance) const
+{
+    const size_t plants = terms.size ();
+    for (int slot = 0; slot < slots; slot++)
+    {
+        const SunOfInstant sun = sunOf ((double) start + (double) slot * stepSeconds);
+
+        // sin h = sin lat sin dec + cos lat cos dec cos (H + lon), with the cosine of the sum expanded
+        const double cosA = sun.cosDec * sun.cosHourAngle;
+        const double sinA = sun.cosDec * sun.sinHourAngle;
+        float *row = irradiance + (size_t) slot * plants;
+        for (size_t p = 0; p < plants; p++)
+        {
+            const PlantTerms &plant = terms[p];
+            double sinAltitude = plant.sinLatitude * sun.sinDec + plant.cosLatCosLon * cosA - plant.cosLatSinLon * sinA;
+            row[p] = (float) model (plant, sun, sinAltitude);
+        }
+    }
+}
+
+double SunIrradiance::ghi (const size_t plant, const double t) const
+{
+    const SunOfInstant sun = sunOf (t);
+    const PlantTerms &term = terms[plant];
+    double sinAltitude = term.sinLatitude * sun.sinDec
+                         + sun.cosDec * (term.cosLatCosLon * sun.cosHourAngle - term.cosLatSinLon * sun.sinHourAngle);
+    return model (term, sun, sinAltitude);
+}
@@ -0,0 +1,163 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#pragma once
+
+#include <stddef.h>
+#include <time.h>
+#include <vector>
+
+#include "libsunwait.hpp"
+
+/**
+ * @defgroup SunIrradiance Definitions for clear-sky irradiance
+ *
+ * @brief Constants of SunIrradiance
+ */
+/**
+ * @addtogroup SunIrradiance
+ * @{
+ */
+/// Solar constant: irradiance at one astronomical unit, W/m^2
+#define SOLAR_CONSTANT 1361.0
+/**@}*/
+
+/**
+ * @brief Clear-sky models of SunIrradiance
+ */
+typedef enum
+{
+    /// Haurwitz: 1098 cos z exp(-0.059 / cos z), from the zenith angle z alone
+    SUN_CLEAR_SKY_HAURWITZ
+    /// Ineichen and Perez: from the extraterrestrial irradiance, air mass, site elevation and Linke turbidity
+    , SUN_CLEAR_SKY_INEICHEN
+} SunClearSkyModel;
+
+/**
+ * @brief A PV plant (or any site) for SunIrradiance
+ */
+struct SunPlant
+{
+    /// Geographical latitude in decimal degrees (N positive, S negative)
+    double latitude = DEFAULT_LATITUDE;
+    /// Geographical longitude in decimal degrees (E positive, W negative)
+    double longitude = DEFAULT_LONGITUDE;
+    /// Elevation above sea level, metres
+    double elevation = 0.0;
+    /// Linke turbidity of the atmosphere (Ineichen model only), about 2 for clean to 6 for hazy air
+    double linkeTurbidity = 3.0;
+
+    SunPlant() = default;
+    SunPlant(double lat, double lon, double height = 0.0, double turbidity = 3.0)
+        : latitude{lat}, longitude{lon}, elevation{height}, linkeTurbidity{turbidity} {};
+};
+
+/**
+ * @brief Clear-sky global horizontal irradiance (GHI) of many plants
+ *
+ * The sun's position comes from the same ephemeris as the events of this library (Sun::sun_RA_dec, or the
+ * precomputed ChebyshevEphemeris), taken at each instant. For a time slot it is computed once for all plants;
+ * the altitude at each plant is then a few multiply-adds on terms precomputed per plant, followed by the model.
+ * The altitude is geometric (no refraction): below the horizon the irradiance is zero.
+ */
+class SunIrradiance
+{
+    public:
+    /**
+     * @brief Prepare the plant terms
+     *
+     * @param plants Plant set
+     * @param model Clear-sky model
+     * @param ephemeris Optional precomputed ephemeris, see SunWait::ephemeris
+     */
+        SunIrradiance(const std::vector<SunPlant> &plants, const SunClearSkyModel model = SUN_CLEAR_SKY_INEICHEN,
+                      const ChebyshevEphemeris *ephemeris = nullptr);
+
+    /**
+     * @brief GHI time series of all plants
+     *
+     * @param start Time of the first slot, seconds since the epoch
+     * @param stepSeconds Time between slots
+     * @param slots Number of slots
+     * @param irradiance Output, slots * plants values in W/m^2, slot-major: plant p of slot i at i * plants + p
+     */
+        void ghi (const time_t start, const int stepSeconds, const int slots, float *irradiance) const;
+
+    /**
+     * @brief GHI of one plant at one instant, W/m^2
+     *
+     * @param plant Index in the plant set
+     * @param t Seconds since the epoch
+     */
+        double ghi (const size_t plant, const double t) const;
+
+    /**
+     * @brief Relative optical air mass (Kasten and Young, 1989)
+     *
+     * @param altitude Geometric altitude of the sun, degrees
+     * @return Air mass relative to the zenith at sea level, or 0 with the sun below the horizon
+     */
+        static double airMass (const double altitude);
+
+    /**
+     * @brief Irradiance at the top of the atmosphere, normal to the sun, W/m^2
+     *
+     * @param r Distance of the sun in astronomical units, as returned by Sun::sunpos
+     */
+        static double extraterrestrial (const double r) { return SOLAR_CONSTANT / (r * r); }
+
+    /// Number of plants
+        size_t size () const { return terms.size (); }
+
+    private:
+        struct SunOfInstant
+        {
+            double sinDec;
+            double cosDec;
+            double cosHourAngle;     // at Greenwich
+            double sinHourAngle;
+            double extraterrestrial;
+        };
+        struct PlantTerms
+        {
+            double sinLatitude;
+            double cosLatCosLon;
+            double cosLatSinLon;
+            double pressure;         // absolute air mass / relative air mass
+            double cg1;              // Ineichen coefficients, with the elevation and turbidity folded in
+            double attenuation;
+        };
+
+        SunOfInstant sunOf (const double t) const;
+        double model (const PlantTerms &plant, const SunOfInstant &sun, const double sinAltitude) const;
+
+        std::vector<PlantTerms> terms;
+        SunClearSkyModel clearSky;
+        const ChebyshevEphemeris *ephemeris;
+};
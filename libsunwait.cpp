@@ -47,6 +47,7 @@
 #include <iostream>
 #include <cstring>
 #include <math.h>
+#include <algorithm>
 
 #include <thread>
 #include <chrono>
@@ -64,12 +65,21 @@
 #include "libsunwait.hpp"
 #include "sun.hpp"
 #include "sunarc.hpp"
+#include "suncache.hpp"
+#include "formatter.hpp"
+#include "waittoken.hpp"
+#include "sunclock.hpp"
 
 using namespace std;
 
 static const char* cTo    = " to ";
 static const char* cComma = ", ";
 
+static const double cWaitSliceSeconds = 60.0;   // longest sleep of wait() before the clocks are compared
+static const double cClockJumpSeconds = 1.0;    // difference of the clocks treated as a clock step
+
+static SystemClock systemClock;
+
 
 inline long   myRound (const double d)
 {
@@ -155,25 +165,40 @@ inline double revolution (const double x)
 
 
 
-inline unsigned long daysSince2000 (const time_t *pTimet)
+/*
+** Midnight UTC of the day given and the same day as days since 2000, by integer
+** arithmetic only. Used by the batch functions, which can't afford a mktime() per value.
+*/
+inline time_t fastMidnightUTC (const time_t timet)
 {
-    struct tm tmpTm;
-
-    myUtcTime (pTimet, &tmpTm);
-
-    unsigned int yearsSince2000 = tmpTm.tm_year - 100; // Get year, but tm_year starts from 1900
+    time_t secondsOfDay = timet % 86400;
+    if (secondsOfDay < 0) secondsOfDay += 86400;
+    return timet - secondsOfDay;
+}
 
-    // Calucate number of leap days, but -
-    //   yearsSince2000 - 1
-    // Don't include this year as tm_yday includes this year's leap day in the next bit
+inline unsigned long fastDaysSince2000 (const time_t midnightTimet)
+{
+    return (unsigned long) (midnightTimet / 86400 - (DAYS_TO_2000));
+}
 
-    unsigned int leapDaysSince2000
-        = (unsigned int) floor ((yearsSince2000 - 1) / 4) // Every evenly divisible 4 years is a leap-year
-          - (unsigned int) floor ((yearsSince2000 - 1) / 100) // Except centuries
-          + (unsigned int) floor ((yearsSince2000 - 1) / 400) // Unless evenlt divisible by 400
-          + 1;                                             // 2000 itself was a leap year with the 400 rule (a fix for 0/400 == 0)
+/*
+** Days since 2000 of the UTC day of the time, for the scalar and batch functions alike. Days before 2000
+** wrap around to large values, which Sun::riset reads back as signed.
+*/
+inline unsigned long daysSince2000 (const time_t *pTimet)
+{
+    return fastDaysSince2000 (fastMidnightUTC (*pTimet));
+}
 
-    return (yearsSince2000 * 365) + leapDaysSince2000 + tmpTm.tm_yday;
+/*
+** Is the time, given in seconds after midnight UTC, within one of the three
+** day intervals filled in by SunWait::dayBounds()?
+*/
+inline bool isDayWithin (const double *pBounds, const double pSeconds)
+{
+    return (pSeconds >= pBounds[0] && pSeconds <= pBounds[1])
+           || (pSeconds >= pBounds[2] && pSeconds <= pBounds[3])
+           || (pSeconds >= pBounds[4] && pSeconds <= pBounds[5]);
 }
 
 
@@ -315,36 +340,6 @@ inline  void myDebugTime (const char * pTitleChar, const time_t *pTimet)
 
 
 
-/*
-** Return time_t of midnight UTC on the day given
-** In effect, this function is going to shave upto 24 hours off a time
-** returning 00:00 UTC on the day given.
-*/
-inline  time_t getMidnightUTC (const time_t *pTimet)
-{
-    struct tm tmpTm;
-
-    // Convert target "struct tm" to time_t.  It'll be set to midnight local time, on the target day.
-    myUtcTime (pTimet, &tmpTm);
-
-    // Set to the start of the day
-    tmpTm.tm_hour = 0;
-    tmpTm.tm_min  = 0;
-    tmpTm.tm_sec  = 0;
-
-    // Fiddle with other "struct tm" fields to get things right
-    tmpTm.tm_wday  = 0;   // mktime will ignore this when calculating time_t as it contradicts days and months
-    tmpTm.tm_yday  = 0;   // mktime will ignore this when calculating time_t as it contradicts days and months
-    tmpTm.tm_isdst = -1;  // -1 means: mktime() must work it out. 0=DST not in effect. 1=DST in effect. (Daylight Savings)
-
-    // Shave off (add) UTC offset, so that time_t is converted from midnight local-time to midnight UTC on the target day
-    tmpTm.tm_sec += myRound (getUtcBiasHours (pTimet) * 3600.0);
-
-    // Let mktime() do it's magic
-    return mktime (&tmpTm);
-}
-
-
 void SunWait::setCoordinates(double lat, double lon)
 {
     latitude = fixLatitude(lat);
@@ -378,84 +373,214 @@ double  SunWait::fixLatitude (const double x)
     return y;
 }
 
-void SunWait::print_a_time( const time_t *pMidnightTimet, const double  pEventHour)
+SunArc SunWait::riset (const unsigned long day, const double angle)
 {
-    struct tm tmpTm;
-    char tmpBuffer [80];
+    if (cache != nullptr) return cache->riset (latitude, longitude, angle, day, ephemeris, position);
 
-    // Convert current time to struct tm for UTC or local timezone
-    if (utc)
+    if (position == SUN_POSITION_NOAA)
     {
-        myUtcTime   (pMidnightTimet, &tmpTm);
-        tmpTm.tm_min += (int) (pEventHour * 60.0);
-        /*time_t x = */mktime (&tmpTm);
-        //myUtcTime   (&x, &tmpTm);
+        SunNOAA sun(longitude, latitude, angle);
+        sun.ephemeris = ephemeris;
+        return sun.riset(day);
     }
-    else
+
+    Sun sun(longitude, latitude, angle);
+    sun.ephemeris = ephemeris;
+    return sun.riset(day);
+}
+
+/*
+** Time the evaluations of one backend. The instants are spread over 1900-2100 by a
+** step that is not a multiple of a day, so the sidereal time and the season both vary.
+*/
+template <typename SunKernel>
+static double timePosition (const int samples, double *positions)
+{
+    const double first = -36524.0, step = 73048.0 / samples;
+    auto start = std::chrono::steady_clock::now ();
+    for (int i = 0; i < samples; i++)
     {
-        myLocalTime (pMidnightTimet, &tmpTm);
-        tmpTm.tm_min += (int) (pEventHour * 60.0);
-        mktime (&tmpTm);
+        double *p = positions + 4 * i;
+        SunKernel::sun_RA_dec (first + step * i, &p[0], &p[1], &p[2]);
+        p[3] = SunKernel::GMST0 (first + step * i);
     }
+    return std::chrono::duration<double, std::nano> (std::chrono::steady_clock::now () - start).count () / samples;
+}
+
+SunPositionInfo SunWait::positionInfo (const SunPositionBackend position, const int samples)
+{
+    SunPositionInfo info;
+    if (samples < 1) return info;
 
-    strftime (tmpBuffer, 80, "%H:%M", &tmpTm);
-    printf ("%s", tmpBuffer);
+    std::vector<double> reference ((size_t) samples * 4), positions ((size_t) samples * 4);
+    double nsNOAA = timePosition<SunNOAA> (samples, reference.data ());
+    if (position == SUN_POSITION_NOAA)
+    {
+        info.name = "noaa";
+        info.nsPerEvaluation = nsNOAA;
+        info.nominalError = 0.01;       // Meeus, Astronomical Algorithms, chapter 25
+        return info;
+    }
+
+    info.name = "schlyter";
+    info.nominalError = 2.0 / 60.0;     // Schlyter, How to compute planetary positions: 1-2 arc minutes
+    info.nsPerEvaluation = timePosition<Sun> (samples, positions.data ());
+    for (int i = 0; i < samples; i++)
+    {
+        const double *p = &positions[4 * (size_t) i], *q = &reference[4 * (size_t) i];
+        double cosSeparation = sind(p[1]) * sind(q[1]) + cosd(p[1]) * cosd(q[1]) * cosd(p[0] - q[0]);
+        double separation = acosd(fmin (cosSeparation, 1.0));
+        double sidereal = fabs (fmod (p[3] - q[3] + 540.0, 360.0) - 180.0);
+        if (separation > info.deviationFromNOAA) info.deviationFromNOAA = separation;
+        if (sidereal > info.siderealDeviationFromNOAA) info.siderealDeviationFromNOAA = sidereal;
+    }
+    return info;
+}
+
+/*
+** Offsets of the output timezone (UTC or local) for times between from and to
+*/
+UtcOffsetTable SunWait::timezone (const time_t from, const time_t to)
+{
+    if (utc) return UtcOffsetTable ();
+    return UtcOffsetTable (from, to);
+}
+
+void SunWait::print_a_time( const time_t *pMidnightTimet, const double  pEventHour)
+{
+    UtcOffsetTable zone = timezone (*pMidnightTimet - 86400, *pMidnightTimet + 2 * 86400);
+    EventWriter writer (stdout, TIME_FORMAT_HHMM, &zone, 64);
+    writer.time (*pMidnightTimet + 60 * (time_t) (int) (pEventHour * 60.0));
 }
 
-void SunWait::print_a_sun_time( const time_t *pMidnightTimet, const double  pEventHour, const double  pOffsetDiurnalArc)
+void SunWait::write_a_sun_time( EventWriter &writer, const time_t pMidnightTimet, const double pEventHour,
+                                const double pOffsetDiurnalArc)
 {
     // A positive offset reduces the diurnal arc
     if (pOffsetDiurnalArc <=  0.0 || pOffsetDiurnalArc >= 24.0)
-        printf ("--:--");
+        writer.text ("--:--");
     else
-        print_a_time (pMidnightTimet, pEventHour);
+        writer.time (pMidnightTimet + 60 * (time_t) (int) (pEventHour * 60.0));
 }
 
-void SunWait::print_times( const time_t   pMidnightTimet, SunArc  result, const double   pOffset, const char   *pSeparator)
+void SunWait::write_times( EventWriter &writer, const time_t pMidnightTimet, SunArc result, const double pOffset,
+                           const char *pSeparator)
 {
     double offsetDiurnalArc = result.diurnalArcWithOffset (pOffset);
     double riseHour         = result.getOffsetRiseHourUTC (pOffset);
     double setHour          = result.getOffsetSetHourUTC  (pOffset);
 
-    print_a_sun_time (&pMidnightTimet, riseHour, offsetDiurnalArc);
-    printf ("%s", pSeparator);
-    print_a_sun_time (&pMidnightTimet, setHour, offsetDiurnalArc);
+    write_a_sun_time (writer, pMidnightTimet, riseHour, offsetDiurnalArc);
+    writer.text (pSeparator);
+    write_a_sun_time (writer, pMidnightTimet, setHour, offsetDiurnalArc);
 
-    if (offsetDiurnalArc >= 24.0) printf (" (Midnight sun)");
-    else if (offsetDiurnalArc <=  0.0) printf (" (Polar night)");
+    if (offsetDiurnalArc >= 24.0) writer.text (" (Midnight sun)");
+    else if (offsetDiurnalArc <=  0.0) writer.text (" (Polar night)");
 
-    printf ("\n");
+    writer.character ('\n');
+}
+
+void SunWait::print_times( const time_t   pMidnightTimet, SunArc  result, const double   pOffset, const char   *pSeparator)
+{
+    UtcOffsetTable zone = timezone (pMidnightTimet - 86400, pMidnightTimet + 2 * 86400);
+    EventWriter writer (stdout, TIME_FORMAT_HHMM, &zone, 256);
+    write_times (writer, pMidnightTimet, result, pOffset, pSeparator);
 }
 
 void SunWait::generate_report (const int year, const int month, const int day)
+{
+    print_report (report (year, month, day));
+}
+
+SunReport SunWait::report (const int year, const int month, const int day, const time_t now)
 {
     time_t targetTimet = targetTime(year, month, day);
-    unsigned long t2000 = daysSince2000(&targetTimet);
     if (debug) myDebugTime ("Target:", &targetTimet);
 
-    Sun sun(longitude, latitude, TWILIGHT_ANGLE_DAYLIGHT);
-    SunArc tmpTarget = sun.riset(t2000);
+    time_t nowTimet = now;
+    if (now == NOT_SET) nowTimet = currentTime ();
 
+    SunReport result;
+    fill_report (result, targetTimet, nowTimet, fastMidnightUTC (nowTimet));
+    return result;
+}
+
+void SunWait::report (const SunSite *sites, const size_t count, SunReport *reports, const int year, const int month,
+                      const int day, const time_t now)
+{
+    time_t targetTimet = targetTime(year, month, day);
+    if (debug) myDebugTime ("Target:", &targetTimet);
+
+    time_t nowTimet = now;
+    if (now == NOT_SET) nowTimet = currentTime ();
+    time_t nowMidnightUTC = fastMidnightUTC (nowTimet);
+
+    SunWait site = *this;
+    for (size_t i = 0; i < count; i++)
+    {
+        site.latitude      = fixLatitude  (sites[i].latitude);
+        site.longitude     = fixLongitude (sites[i].longitude);
+        site.twilightAngle = sites[i].twilightAngle;
+        site.offsetHour    = sites[i].offsetHour;
+        site.fill_report (reports[i], targetTimet, nowTimet, nowMidnightUTC);
+    }
+}
+
+/*
+** Compute the arcs of the target date, and the day/night state at nowTimet
+** (reusing the arcs of the target date where the days overlap).
+*/
+void SunWait::fill_report (SunReport &result, const time_t targetTimet, const time_t nowTimet,
+                           const time_t nowMidnightUTC)
+{
+    unsigned long t2000 = daysSince2000(&targetTimet);
+
+    result.latitude      = latitude;
+    result.longitude     = longitude;
+    result.twilightAngle = twilightAngle;
+    result.offsetHour    = offsetHour;
+    result.midnightUTC   = targetTimet;
+    result.now           = nowTimet;
+
+    result.daylight     = riset(t2000, TWILIGHT_ANGLE_DAYLIGHT);
+    result.civil        = riset(t2000, TWILIGHT_ANGLE_CIVIL);
+    result.nautical     = riset(t2000, TWILIGHT_ANGLE_NAUTICAL);
+    result.astronomical = riset(t2000, TWILIGHT_ANGLE_ASTRONOMICAL);
+
+    if      (twilightAngle == (TWILIGHT_ANGLE_DAYLIGHT))     result.target = result.daylight;
+    else if (twilightAngle == (TWILIGHT_ANGLE_CIVIL))        result.target = result.civil;
+    else if (twilightAngle == (TWILIGHT_ANGLE_NAUTICAL))     result.target = result.nautical;
+    else if (twilightAngle == (TWILIGHT_ANGLE_ASTRONOMICAL)) result.target = result.astronomical;
+    else result.target = riset(t2000, twilightAngle);
+
+    // Day or night at nowTimet, as poll(nowTimet) works it out
+    unsigned long nowDay = daysSince2000(&nowTimet);
+    SunArc arcs[3] = { result.target, result.target, result.target };
+    for (int i = 0; i < 3; i++)
+    {
+        unsigned long day = nowDay - 1 + i;
+        if (day != t2000) arcs[i] = riset(day, twilightAngle);
+    }
+    double bounds[6];
+    arcBounds (arcs[0], arcs[1], arcs[2], bounds);
+    result.isDay = isDayWithin (bounds, difftime (nowTimet, nowMidnightUTC)) ? EXIT_DAY : EXIT_NIGHT;
+}
+
+void SunWait::print_report (const SunReport &result)
+{
+    time_t targetTimet = result.midnightUTC;
 
     /*
     ** Now generate the report
     */
-    time_t nowTimet;
-    time(&nowTimet);
+    time_t nowTimet = result.now;
     struct tm nowTm;
-    struct tm targetTm;
     char buffer [80];
 
     if (utc)
-    {
         myUtcTime (&nowTimet,    &nowTm);
-        myUtcTime (&targetTimet, &targetTm);
-    }
     else
-    {
         myLocalTime (&nowTimet,    &nowTm);
-        myLocalTime (&targetTimet, &targetTm);
-    }
 
     printf ("\n");
 
@@ -467,8 +592,8 @@ void SunWait::generate_report (const int year, const int month, const int day)
 
     printf
     ("                   Location: %10.6fN, %10.6fE\n"
-     , latitude
-     , longitude
+     , result.latitude
+     , result.longitude
     );
 
     strftime (buffer, 80, "%d-%b-%Y", &nowTm);
@@ -481,74 +606,59 @@ void SunWait::generate_report (const int year, const int month, const int day)
 
     printf
     ("   Sun directly north/south: ");
-    print_a_time (&targetTimet, tmpTarget.southHourUTC);
+    print_a_time (&targetTimet, result.daylight.southHourUTC);
     printf ("\n");
 
-    if (offsetHour != NO_OFFSET)
+    if (result.offsetHour != NO_OFFSET)
     {
         printf
         ( "                     Offset: %2.2d:%2.2d hours\n"
-          , hours   (offsetHour)
-          , minutes (offsetHour)
+          , hours   (result.offsetHour)
+          , minutes (result.offsetHour)
         );
     }
 
-    if (twilightAngle == TWILIGHT_ANGLE_DAYLIGHT)     printf("             Twilight angle: %5.2f degrees (daylight)\n",
-                twilightAngle);
-    else if (twilightAngle == TWILIGHT_ANGLE_CIVIL)        printf("             Twilight angle: %5.2f degrees (civil)\n",
-                twilightAngle);
-    else if (twilightAngle == TWILIGHT_ANGLE_NAUTICAL)     printf("             Twilight angle: %5.2f degrees (nautical)\n",
-                twilightAngle);
-    else if (twilightAngle == TWILIGHT_ANGLE_ASTRONOMICAL) printf("             Twilight angle: %5.2f degrees (astronomical)\n",
-                twilightAngle);
+    if (result.twilightAngle == TWILIGHT_ANGLE_DAYLIGHT)     printf("             Twilight angle: %5.2f degrees (daylight)\n",
+                result.twilightAngle);
+    else if (result.twilightAngle == TWILIGHT_ANGLE_CIVIL)        printf("             Twilight angle: %5.2f degrees (civil)\n",
+                result.twilightAngle);
+    else if (result.twilightAngle == TWILIGHT_ANGLE_NAUTICAL)     printf("             Twilight angle: %5.2f degrees (nautical)\n",
+                result.twilightAngle);
+    else if (result.twilightAngle == TWILIGHT_ANGLE_ASTRONOMICAL) printf("             Twilight angle: %5.2f degrees (astronomical)\n",
+                result.twilightAngle);
     else
-        printf("             Twilight angle: %5.2f degrees (custom angle)\n", twilightAngle);
+        printf("             Twilight angle: %5.2f degrees (custom angle)\n", result.twilightAngle);
 
     printf   ("          Day with twilight: ");
-    print_times (targetTimet, tmpTarget, NO_OFFSET, cTo);
+    print_times (targetTimet, result.daylight, NO_OFFSET, cTo);
 
-    if (offsetHour != NO_OFFSET)
+    if (result.offsetHour != NO_OFFSET)
     {
         printf (" Day with twilight & offset: ");
-        print_times (targetTimet, tmpTarget, offsetHour, cTo);
+        print_times (targetTimet, result.daylight, result.offsetHour, cTo);
     }
 
-    printf   ("                      It is: %s\n", poll () == EXIT_DAY ? "Day (or twilight)" : "Night");
-
-    /*
-    ** Generate times for different types of twilight
-    */
-
-    SunArc  daylightTarget = sun.riset(t2000);
-
-    sun.twilightAngle = TWILIGHT_ANGLE_CIVIL;
-    SunArc civilTarget = sun.riset(t2000);
-
-    sun.twilightAngle = TWILIGHT_ANGLE_NAUTICAL;
-    SunArc  nauticalTarget = sun.riset(t2000);
-
-    sun.twilightAngle = TWILIGHT_ANGLE_ASTRONOMICAL;
-    SunArc astronomicalTarget = sun.riset(t2000);
+    printf   ("                      It is: %s\n", result.isDay == EXIT_DAY ? "Day (or twilight)" : "Night");
 
     printf ("\nGeneral Information (no offset) ...\n\n");
 
     printf (" Times ...         Daylight: ");
-    print_times (targetTimet, daylightTarget,  NO_OFFSET, cTo);
+    print_times (targetTimet, result.daylight,  NO_OFFSET, cTo);
     printf ("        with Civil twilight: ");
-    print_times (targetTimet, civilTarget,        NO_OFFSET, cTo);
+    print_times (targetTimet, result.civil,        NO_OFFSET, cTo);
     printf ("     with Nautical twilight: ");
-    print_times (targetTimet, nauticalTarget,     NO_OFFSET, cTo);
+    print_times (targetTimet, result.nautical,     NO_OFFSET, cTo);
     printf (" with Astronomical twilight: ");
-    print_times (targetTimet, astronomicalTarget, NO_OFFSET, cTo);
+    print_times (targetTimet, result.astronomical, NO_OFFSET, cTo);
     printf ("\n");
-    printf (" Duration ...    Day length: %2.2d:%2.2d hours\n", hours (    daylightTarget.diurnalArc),
-            minutes (    daylightTarget.diurnalArc));
-    printf ("        with civil twilight: %2.2d:%2.2d hours\n", hours (       civilTarget.diurnalArc),
-            minutes (       civilTarget.diurnalArc));
-    printf ("     with nautical twilight: %2.2d:%2.2d hours\n", hours (    nauticalTarget.diurnalArc),
-            minutes (    nauticalTarget.diurnalArc));
-    printf (" with astronomical twilight: %2.2d:%2.2d hours\n", hours (astronomicalTarget.diurnalArc),
-            minutes (astronomicalTarget.diurnalArc));
+    printf (" Duration ...    Day length: %2.2d:%2.2d hours\n", hours (    result.daylight.diurnalArc),
+            minutes (    result.daylight.diurnalArc));
+    printf ("        with civil twilight: %2.2d:%2.2d hours\n", hours (       result.civil.diurnalArc),
+            minutes (       result.civil.diurnalArc));
+    printf ("     with nautical twilight: %2.2d:%2.2d hours\n", hours (    result.nautical.diurnalArc),
+            minutes (    result.nautical.diurnalArc));
+    printf (" with astronomical twilight: %2.2d:%2.2d hours\n", hours (result.astronomical.diurnalArc),
+            minutes (result.astronomical.diurnalArc));
     printf ("\n");
 }
 
@@ -560,13 +670,16 @@ void SunWait::print_list (const int days, const int year, const int month, const
 
     unsigned long t2000 = daysSince2000(&targetTimet);
 
-    Sun sun(longitude, latitude, twilightAngle);
+    // All days are printed relative to the target's midnight, so one day of timezone offsets is enough
+    UtcOffsetTable zone = timezone (targetTimet - 86400, targetTimet + 2 * 86400);
+    EventWriter writer (stdout, TIME_FORMAT_HHMM, &zone);
 
     for (int dday = 0; dday < days; dday++)
     {
-        SunArc  tmpTarget = sun.riset(t2000);
-        print_times
-        ( targetTimet
+        SunArc  tmpTarget = riset(t2000, twilightAngle);
+        write_times
+        ( writer
+          , targetTimet
           , tmpTarget
           , offsetHour
           , cComma
@@ -589,8 +702,8 @@ std::pair<time_t, time_t> SunWait::get_times
     double setHour          = result.getOffsetSetHourUTC  (pOffset);
 
     std::pair<time_t, time_t> res;
-    res.first = pMidnightTimet + riseHour * 3600;
-    res.second = pMidnightTimet + setHour * 3600;
+    res.first = (time_t) floor (pMidnightTimet + riseHour * 3600);
+    res.second = (time_t) floor (pMidnightTimet + setHour * 3600);
 
     if (offsetDiurnalArc >= 24.0)
     {
@@ -612,7 +725,6 @@ std::pair<std::vector<time_t>, std::vector<time_t>> SunWait::list (const int day
 {
     std::vector<time_t> rises;
     std::vector<time_t> sets;
-    Sun sun(longitude, latitude, twilightAngle);
 
     for (int d = 0; d < days; d++)
     {
@@ -621,7 +733,7 @@ std::pair<std::vector<time_t>, std::vector<time_t>> SunWait::list (const int day
 
         unsigned long t2000 = daysSince2000(&targetTimet);
 
-        SunArc  tmpTarget = sun.riset(t2000);
+        SunArc  tmpTarget = riset(t2000, twilightAngle);
 
         std::pair<time_t, time_t> sunriset = get_times
                                              ( targetTimet
@@ -651,37 +763,145 @@ int SunWait::poll (const time_t ttime)
     }
     else
     {
-        time(&nowTimet);
+        nowTimet = currentTime ();
         if (debug) myDebugTime ("Now:", &nowTimet);
     }
-    time_t midnightUTC = getMidnightUTC (&nowTimet);
-    double nowHourUTC = difftime (nowTimet, midnightUTC) / (3600.0);
+    time_t midnightUTC = fastMidnightUTC (nowTimet);
+    double nowSecondsUTC = difftime (nowTimet, midnightUTC);
+
+    double bounds[6];
+    dayBounds (daysSince2000(&nowTimet), bounds);
+
+    // Figure out if we're between sunrise and sunset (with offset) of any of the three days
+    return isDayWithin (bounds, nowSecondsUTC) ? EXIT_DAY : EXIT_NIGHT;
+}
+
+bool SunWait::next_event (const time_t after, time_t *eventTime, bool *isRise)
+{
+    // The day intervals of poll(), day by day. Those of polar days overlap and are merged,
+    // so the start and end of a polar day count as sun rise and set.
+    // Start with yesterday, whose set may still be ahead for sites far from Greenwich.
+    time_t midnightUTC = fastMidnightUTC (after);
+    unsigned long day = fastDaysSince2000 (midnightUTC);
+    bool open = false;
+    double mergedSet = 0.0;
+
+    for (int d = -1; d < 370; d++)
+    {
+        SunArc arc = riset(day + d, twilightAngle);
+        if (arc.diurnalArcWithOffset (offsetHour) <= 0.0) continue;
 
+        // Rounded down to the second like list(): the state changes within the second after the event
+        double dayStart = (double) (midnightUTC + (time_t) d * 86400);
+        double rise = dayStart + arc.getOffsetRiseHourUTC (offsetHour) * 3600;
+        double set  = dayStart + arc.getOffsetSetHourUTC  (offsetHour) * 3600;
+
+        // poll() is asked about whole seconds only: a day or night which contains none of them is no event
+        if (ceil (rise) > set) continue;
+        if (open && rise <= floor (mergedSet) + 1.0)
+        {
+            mergedSet = std::max (mergedSet, set);
+            continue;
+        }
+        if (open && (time_t) floor (mergedSet) > after)
+        {
+            *eventTime = (time_t) floor (mergedSet);
+            if (isRise != nullptr) *isRise = false;
+            return true;
+        }
+        if ((time_t) floor (rise) > after)
+        {
+            *eventTime = (time_t) floor (rise);
+            if (isRise != nullptr) *isRise = true;
+            return true;
+        }
+        open = true;
+        mergedSet = set;
+    }
+    return false;
+}
+
+/*
+** Fill in the offset rise and set times of yesterday, today and tomorrow,
+** in seconds after midnight UTC of the given day.
+*/
+void SunWait::dayBounds (const unsigned long day, double *bounds)
+{
     // If the time is before sunrise or after sunset, I need to know that
     // we're not in the daylight of either the neighbouring days.
-    Sun sun(longitude, latitude, twilightAngle);
-    unsigned long now2000 = daysSince2000(&nowTimet);
-    SunArc yesterday = sun.riset(now2000 - 1);
-    SunArc today = sun.riset(now2000);
-    SunArc tomorrow = sun.riset(now2000 + 1);
+    arcBounds (riset(day - 1, twilightAngle), riset(day, twilightAngle), riset(day + 1, twilightAngle), bounds);
+}
 
+void SunWait::arcBounds (SunArc yesterday, SunArc today, SunArc tomorrow, double *bounds)
+{
     yesterday.southHourUTC -= 24.0;
     tomorrow.southHourUTC += 24.0;
 
-    // Get the time (0-24) of sunrise and set, of the three days
-    double riseHourUTCYesterday = yesterday.getOffsetRiseHourUTC (offsetHour);
-    double  setHourUTCYesterday =  yesterday.getOffsetSetHourUTC (offsetHour);
-    double riseHourUTCToday     = today.getOffsetRiseHourUTC (offsetHour);
-    double  setHourUTCToday     =  today.getOffsetSetHourUTC (offsetHour);
-    double riseHourUTCTomorrow  = tomorrow.getOffsetRiseHourUTC (offsetHour);
-    double  setHourUTCTomorrow  =  tomorrow.getOffsetSetHourUTC (offsetHour);
+    // Get the time of sunrise and set, of the three days
+    bounds[0] = 3600.0 * yesterday.getOffsetRiseHourUTC (offsetHour);
+    bounds[1] = 3600.0 * yesterday.getOffsetSetHourUTC  (offsetHour);
+    bounds[2] = 3600.0 * today.getOffsetRiseHourUTC     (offsetHour);
+    bounds[3] = 3600.0 * today.getOffsetSetHourUTC      (offsetHour);
+    bounds[4] = 3600.0 * tomorrow.getOffsetRiseHourUTC  (offsetHour);
+    bounds[5] = 3600.0 * tomorrow.getOffsetSetHourUTC   (offsetHour);
+}
 
-    // Figure out if we're between sunrise and sunset (with offset) of any of the three days
-    return
-        (  (nowHourUTC >= riseHourUTCYesterday && nowHourUTC <= setHourUTCYesterday)
-           || (nowHourUTC >= riseHourUTCToday     && nowHourUTC <= setHourUTCToday    )
-           || (nowHourUTC >= riseHourUTCTomorrow  && nowHourUTC <= setHourUTCTomorrow )
-        ) ? EXIT_DAY : EXIT_NIGHT;
+/*
+** Label many times as day or night. The rise and set times are only computed
+** when the UTC day changes. For sorted input the only per-value work besides the
+** comparisons is checking for the end of the day; otherwise each value's day is
+** computed and compared against the day currently held.
+*/
+template <typename Label>
+void SunWait::pollBatch (const time_t *ttimes, const size_t count, Label label)
+{
+    double bounds[6];
+    size_t i = 0;
+
+    if (std::is_sorted (ttimes, ttimes + count))
+    {
+        while (i < count)
+        {
+            time_t midnightUTC = fastMidnightUTC (ttimes[i]);
+            time_t nextMidnightUTC = midnightUTC + 86400;
+            dayBounds (fastDaysSince2000 (midnightUTC), bounds);
+
+            for (; i < count && ttimes[i] < nextMidnightUTC; i++)
+                label (i, isDayWithin (bounds, (double) (ttimes[i] - midnightUTC)));
+        }
+        return;
+    }
+
+    time_t midnightUTC = 0;
+    bool   haveDay = false;
+    for (; i < count; i++)
+    {
+        time_t thisMidnightUTC = fastMidnightUTC (ttimes[i]);
+        if (!haveDay || thisMidnightUTC != midnightUTC)
+        {
+            midnightUTC = thisMidnightUTC;
+            dayBounds (fastDaysSince2000 (midnightUTC), bounds);
+            haveDay = true;
+        }
+        label (i, isDayWithin (bounds, (double) (ttimes[i] - midnightUTC)));
+    }
+}
+
+void SunWait::poll (const time_t *ttimes, const size_t count, unsigned char *isDay)
+{
+    pollBatch (ttimes, count, [isDay] (size_t i, bool day)
+    {
+        isDay[i] = day ? 1 : 0;
+    });
+}
+
+void SunWait::pollBits (const time_t *ttimes, const size_t count, uint64_t *isDayBits)
+{
+    memset (isDayBits, 0, ((count + 63) / 64) * sizeof (uint64_t));
+    pollBatch (ttimes, count, [isDayBits] (size_t i, bool day)
+    {
+        isDayBits[i / 64] |= (uint64_t) day << (i % 64);
+    });
 }
 
 
@@ -699,8 +919,7 @@ time_t SunWait::targetTime(int year, int mon, int mday)
     // Get the target day (as "struct tm") for "now" - the default
     // I'll get the local-time day, as it'll make sense with the user, unless UTC was asked for
     //
-    time_t nowTimet;
-    time(&nowTimet);
+    time_t nowTimet = currentTime ();
 
     if (utc)
         myUtcTime   (&nowTimet, &targetTm); // User wants UTC
@@ -787,6 +1006,134 @@ time_t SunWait::targetTime(int year, int mon, int mday)
 */
 
 int SunWait::wait (bool reportSunrise, bool reportSunset, unsigned long *waitptr)
+{
+    double nowSeconds = source ().now ();
+    double deadline;
+    if (eventDeadline (reportSunrise, reportSunset, nowSeconds, &deadline) != EXIT_OK) return EXIT_ERROR;
+
+    //
+    // In debug mode, we don't want to wait for sunrise or sunset. Wait a minute instead.
+    //
+
+    if (debug)
+    {
+        printf("Debug: Wait reduced from %li to 10 seconds.\n", (long) (deadline - nowSeconds));
+        deadline = nowSeconds + 10.0;
+    }
+
+    if (waitptr != nullptr)
+    {
+        *waitptr = (unsigned long) (deadline - nowSeconds);
+        return EXIT_OK;
+    }
+
+    //
+    // Sleep (wait) until the event is expected
+    //
+    sleepUntil (deadline, reportSunrise, reportSunset, nullptr, 0, 0.0);
+    if (debug) printf ("Debug: Woke up %.6f seconds after the event.\n", wakeLatency);
+    return EXIT_OK;
+}
+
+int SunWait::wait (bool reportSunrise, bool reportSunset, WaitToken &token, const double timeoutSeconds)
+{
+    const unsigned long generation = token.generation ();
+    if (token.cancelled ()) return EXIT_CANCELLED;
+
+    double nowSeconds = source ().now ();
+    double deadline;
+    if (eventDeadline (reportSunrise, reportSunset, nowSeconds, &deadline) != EXIT_OK) return EXIT_ERROR;
+
+    if (debug)
+    {
+        printf("Debug: Wait reduced from %li to 10 seconds.\n", (long) (deadline - nowSeconds));
+        deadline = nowSeconds + 10.0;
+    }
+
+    int result = sleepUntil (deadline, reportSunrise, reportSunset, &token, generation, timeoutSeconds);
+    if (debug && result == EXIT_OK) printf ("Debug: Woke up %.6f seconds after the event.\n", wakeLatency);
+    return result;
+}
+
+/*
+** Sleep until the deadline (seconds since the epoch, CLOCK_REALTIME). Long waits are split into
+** slices on a clock which counts suspended time but is not stepped; a difference between the two
+** clocks after a slice means the realtime clock was stepped (NTP, the user), and the event is
+** computed again. The last slice sleeps until the absolute deadline.
+** With a token, the slices block on its condition variable instead, and a timeout (on the
+** unstepped clock) can end the wait early.
+*/
+int SunWait::sleepUntil (double deadline, const bool reportSunrise, const bool reportSunset, WaitToken *token,
+                         const unsigned long generation, const double timeoutSeconds)
+{
+    SunClock &time = source ();
+    // Only the system clocks can be waited on through the token's condition variable
+    const bool blockOnToken = token != nullptr && clock == nullptr;
+
+    double real = time.now ();
+    double elapsed = time.elapsed ();
+    const double timeoutEnd = timeoutSeconds > 0.0 ? elapsed + timeoutSeconds : HUGE_VAL;
+
+    for (;;)
+    {
+        double toEvent = deadline - real;
+        double toTimeout = timeoutEnd - elapsed;
+        if (toEvent <= cWaitSliceSeconds && toEvent <= toTimeout) break;
+
+        double slice = toTimeout < cWaitSliceSeconds ? toTimeout : cWaitSliceSeconds;
+        int state = EXIT_OK;
+        if (blockOnToken) state = token->waitFor (slice, generation, time);
+        else
+        {
+            time.sleep (slice);
+            if (token != nullptr) state = token->waitFor (0.0, generation, time);
+        }
+        if (state != EXIT_OK) return state;
+
+        double newReal = time.now ();
+        double newElapsed = time.elapsed ();
+        double jump = (newReal - real) - (newElapsed - elapsed);
+        real = newReal;
+        elapsed = newElapsed;
+
+        if (elapsed >= timeoutEnd) return EXIT_TIMEOUT;
+
+        if (fabs (jump) > cClockJumpSeconds && real < deadline && !debug)
+        {
+            double recomputed;
+            if (eventDeadline (reportSunrise, reportSunset, real, &recomputed) == EXIT_OK) deadline = recomputed;
+        }
+    }
+
+    int state = EXIT_OK;
+    if (blockOnToken) state = token->waitUntil (deadline, generation);
+    else
+    {
+        time.sleepUntil (deadline);
+        if (token != nullptr) state = token->waitFor (0.0, generation, time);
+    }
+
+    if (state == EXIT_OK) wakeLatency = time.now () - deadline;
+    return state;
+}
+
+/*
+** The injected clock, or the system clocks
+*/
+SunClock &SunWait::source ()
+{
+    return clock != nullptr ? *clock : systemClock;
+}
+
+time_t SunWait::currentTime ()
+{
+    return clock != nullptr ? (time_t) floor (clock->now ()) : time (nullptr);
+}
+
+/*
+** Time of the next requested event after nowSeconds (seconds since the epoch)
+*/
+int SunWait::eventDeadline (const bool reportSunrise, const bool reportSunset, const double nowSeconds, double *deadline)
 {
     //
     // Calculate start/end of twilight for given twilight type/angle.
@@ -804,37 +1151,32 @@ int SunWait::wait (bool reportSunrise, bool reportSunset, unsigned long *waitptr
 
     unsigned long t2000 = daysSince2000(&targetTimet);
 
-    time_t nowTimet;
-    time(&nowTimet);
-
     // If the time is before sunrise or after sunset, I need to know that
     // we're not in the daylight of either the neighbouring days.
-    Sun sun(longitude, latitude, twilightAngle);
-
-    SunArc yesterday = sun.riset(t2000 - 1);
-    SunArc today = sun.riset(t2000);
-    SunArc tomorrow = sun.riset(t2000 + 1);
+    SunArc yesterday = riset(t2000 - 1, twilightAngle);
+    SunArc today = riset(t2000, twilightAngle);
+    SunArc tomorrow = riset(t2000 + 1, twilightAngle);
 
     yesterday.southHourUTC -= 24;
     tomorrow.southHourUTC += 24;
 
-    // Calculate duration (seconds) from "now" to "midnight UTC on the target day". [difftime (end, beginning)]
-    long waitMidnightUTC = static_cast <long> (difftime (targetTimet, nowTimet));
+    // Calculate duration (seconds) from "now" to "midnight UTC on the target day".
+    double waitMidnightUTC = (double) targetTimet - nowSeconds;
 
     // Calculate duration to wait for each day's rise and set (seconds)
     // (targetTimet is set to midnight on the target day)
-    long waitRiseYesterday = waitMidnightUTC + static_cast <long> ( 3600.0 * yesterday.getOffsetRiseHourUTC (offsetHour) );
-    long waitSetYesterday  = waitMidnightUTC + static_cast <long> ( 3600.0 * yesterday.getOffsetSetHourUTC  (offsetHour) );
-    long waitRiseToday     = waitMidnightUTC + static_cast <long> ( 3600.0 * today.getOffsetRiseHourUTC (offsetHour)     );
-    long waitSetToday      = waitMidnightUTC + static_cast <long> ( 3600.0 * today.getOffsetSetHourUTC  (offsetHour)     );
-    long waitRiseTomorrow  = waitMidnightUTC + static_cast <long> ( 3600.0 * tomorrow.getOffsetRiseHourUTC (offsetHour)  );
-    long waitSetTomorrow   = waitMidnightUTC + static_cast <long> ( 3600.0 * tomorrow.getOffsetSetHourUTC  (offsetHour)  );
+    double waitRiseYesterday = waitMidnightUTC + 3600.0 * yesterday.getOffsetRiseHourUTC (offsetHour);
+    double waitSetYesterday  = waitMidnightUTC + 3600.0 * yesterday.getOffsetSetHourUTC  (offsetHour);
+    double waitRiseToday     = waitMidnightUTC + 3600.0 * today.getOffsetRiseHourUTC     (offsetHour);
+    double waitSetToday      = waitMidnightUTC + 3600.0 * today.getOffsetSetHourUTC      (offsetHour);
+    double waitRiseTomorrow  = waitMidnightUTC + 3600.0 * tomorrow.getOffsetRiseHourUTC  (offsetHour);
+    double waitSetTomorrow   = waitMidnightUTC + 3600.0 * tomorrow.getOffsetSetHourUTC   (offsetHour);
 
     // Determine next sunrise and sunset
     // (we may be in DAY, so the next event is sunset - followed by sunrise)
 
-    long waitRiseSeconds = 0;
-    long waitSetSeconds = 0;
+    double waitRiseSeconds = 0;
+    double waitSetSeconds = 0;
 
     if      (waitRiseYesterday > 0)
     {
@@ -925,7 +1267,7 @@ int SunWait::wait (bool reportSunrise, bool reportSunset, unsigned long *waitptr
     // Get next rise or set time UNLESS the opposite event happens first (unless less than 6 hours to required event)
     // IF both rise and set requested THEN wait for whichever is next
 
-    long waitSeconds = 0;
+    double waitSeconds = 0;
 
     if (reportSunrise  && !reportSunset )
     {
@@ -947,41 +1289,7 @@ int SunWait::wait (bool reportSunrise, bool reportSunset, unsigned long *waitptr
         return EXIT_ERROR;
     }
 
-    //
-    // In debug mode, we don't want to wait for sunrise or sunset. Wait a minute instead.
-    //
-
-    if (debug)
-    {
-        printf("Debug: Wait reduced from %li to 10 seconds.\n", waitSeconds);
-        waitSeconds = 10;
-    }
-    // else if (pRun->functionPoll == ONOFF_ON) waitSeconds += 60; // Make more sure that a subsequent POLL works properly (wink ;-)
-
-    //
-    // Sleep (wait) until the event is expected
-    //
-    if(waitptr == nullptr)
-    {
-        std::this_thread::sleep_for(std::chrono::seconds{waitSeconds});
-        /*
-          // Windows code: Start
-          #if defined _WIN32 || defined _WIN64
-            waitSeconds *= 1000; // Convert hours to milliseconds for Windows
-            Sleep ((DWORD) waitSeconds); // Windows-only . waitSec is tested positive or zero
-          #endif
-          // Windows code: End
-
-          // Linux code: Start
-          #if defined __linux__ || defined __APPLE__
-            sleep (waitSeconds);    // Linux-only (seconds OK)
-          #endif
-          // Linux code: End */
-    }
-    else
-    {
-        *waitptr = waitSeconds;
-    }
+    *deadline = nowSeconds + waitSeconds;
     return EXIT_OK;
 }
 
@@ -35,10 +35,13 @@
 //
 
 #include <time.h>
+#include <stdint.h>
 #include <vector>
 #include <utility>
 #include <cstdio>
 
+#include "sunarc.hpp"
+
 #ifndef LIBSUNWAIT_HPP
 #define LIBSUNWAIT_HPP
 
@@ -61,6 +64,12 @@
 #define EXIT_DAY   2
 /// Poll resulted in "NIGHT"
 #define EXIT_NIGHT 3
+/// Wait was cancelled (see WaitToken)
+#define EXIT_CANCELLED 4
+/// Wait reached its timeout before the event
+#define EXIT_TIMEOUT 5
+/// Wait was interrupted for changed settings (see WaitToken)
+#define EXIT_CHANGED 6
 /**@}*/
 
 #define DEFAULT_LATITUDE  65
@@ -117,7 +126,89 @@
 
 #define DAYS_TO_2000  365*30+7                                   // Number of days from 'C' time epoch (1/1/1970 to 1/1/2000) [including leap days]
 
-struct SunArc;
+class ChebyshevEphemeris;
+class SunCache;
+class UtcOffsetTable;
+class EventWriter;
+class WaitToken;
+class SunClock;
+
+/**
+ * @brief An observing site, as used by the functions working on many sites at once
+ */
+struct SunSite
+{
+    /// Geographical latitude in decimal degrees (N positive, S negative)
+    double latitude = DEFAULT_LATITUDE;
+    /// Geographical longitude in decimal degrees (E positive, W negative)
+    double longitude = DEFAULT_LONGITUDE;
+    /// Twilight angle in degrees, see SunWait::twilightAngle
+    double twilightAngle = TWILIGHT_ANGLE_DAYLIGHT;
+    /// Offset towards midday in hours, see SunWait::offsetHour
+    double offsetHour = NO_OFFSET;
+
+    SunSite() = default;
+    SunSite(double lat, double lon, double angle = TWILIGHT_ANGLE_DAYLIGHT, double offset = NO_OFFSET)
+        : latitude{lat}, longitude{lon}, twilightAngle{angle}, offsetHour{offset} {};
+};
+
+/**
+ * @brief Everything shown by SunWait::generate_report, computed without any output
+ *
+ * The arcs are those of the target date; times of day are hours after midnightUTC.
+ */
+struct SunReport
+{
+    /// Geographical latitude in decimal degrees
+    double latitude = DEFAULT_LATITUDE;
+    /// Geographical longitude in decimal degrees
+    double longitude = DEFAULT_LONGITUDE;
+    /// Twilight angle in degrees
+    double twilightAngle = TWILIGHT_ANGLE_DAYLIGHT;
+    /// Offset towards midday in hours
+    double offsetHour = NO_OFFSET;
+
+    /// Midnight UTC of the target date
+    time_t midnightUTC = 0;
+    /// Time of the day/night state (isDay)
+    time_t now = 0;
+    /// EXIT_DAY or EXIT_NIGHT at now, as returned by SunWait::poll
+    int isDay = EXIT_NIGHT;
+
+    /// Arc for the twilight angle
+    SunArc target{0.0, 0.0};
+    /// Arc for sun rise and set
+    SunArc daylight{0.0, 0.0};
+    /// Arc for civil twilight
+    SunArc civil{0.0, 0.0};
+    /// Arc for nautical twilight
+    SunArc nautical{0.0, 0.0};
+    /// Arc for astronomical twilight
+    SunArc astronomical{0.0, 0.0};
+};
+
+/**
+ * @brief Cost and accuracy of a solar position backend, see SunWait::positionInfo
+ *
+ * No reference ephemeris is at hand, so nothing is measured against the true sun. The deviations are those from
+ * SUN_POSITION_NOAA in double precision over 1900-2100 (zero for SUN_POSITION_NOAA itself): they show how far
+ * apart two backends are, not how accurate either is. The accuracy is the nominal one published for the
+ * formulas.
+ */
+struct SunPositionInfo
+{
+    /// Short name of the backend
+    const char *name = "";
+    /// Measured time of one evaluation (sun_RA_dec and GMST0), nanoseconds
+    double nsPerEvaluation = 0.0;
+    /// Nominal accuracy of the sun's direction given by the source of the formulas, degrees (not measured)
+    double nominalError = 0.0;
+    /// Maximum angle on the sky between the sun's direction (right ascension and declination) and that of
+    /// SUN_POSITION_NOAA, degrees
+    double deviationFromNOAA = 0.0;
+    /// Maximum difference of GMST0 from that of SUN_POSITION_NOAA, degrees (one degree is four minutes of time)
+    double siderealDeviationFromNOAA = 0.0;
+};
 
 /**
  * @brief Main class
@@ -149,6 +240,23 @@ class SunWait
     /// When true, debug information is printed to the standard output.
         bool          debug = false;                                    
 
+    /// Optional precomputed ephemeris (see ChebyshevEphemeris). When set, it replaces the analytic solar position formulas for all operations on the days it covers. It is not owned by the SunWait object and may be shared.
+        const ChebyshevEphemeris *ephemeris = nullptr;
+
+    /// Solar position formulas used when no ephemeris covers the day. SUN_POSITION_SCHLYTER (default) is the fastest,
+    /// SUN_POSITION_NOAA the most accurate (see SunWait::positionInfo). The choice is made once per riset() call; the
+    /// formulas themselves are selected at compile time (see BasicSun).
+        SunPositionBackend position = SUN_POSITION_SCHLYTER;
+
+    /// Optional cache of sun arcs (see SunCache). When set, all operations look up the arcs of the cache cell containing the coordinates, so results may differ from the exact ones by the error bound of the cache. It is not owned by the SunWait object and may be shared.
+        SunCache     *cache = nullptr;
+
+    /// Optional clock (see SunClock, VirtualClock). When set, it replaces the system clocks as the current time and for the sleeps of wait(). It is not owned by the SunWait object.
+        SunClock     *clock = nullptr;
+
+    /// Seconds between the event and the return from the last wait() which slept (positive when late).
+        double        wakeLatency = 0.0;
+
     /**
      * @brief Construct a new SunWait object with default geographical coordinates and twilight angle
      * 
@@ -248,11 +356,40 @@ class SunWait
      * @return Returns one if the return codes EXIT_DAY or EXIT_NIGHT
      */
         int poll (const time_t ttime = NOT_SET);
+
+    /**
+     * @brief Poll whether it is day or night for many times at once.
+     *
+     * The result is the same as calling poll(ttime) for each time: both take the UTC day of a time (and days before
+     * 2000) by the same arithmetic. The sun rise and set times are only computed once for each UTC day and the times
+     * are then labelled by comparisons only.
+     * Sorted input (e.g. a time series) takes a fast path which only checks for the end of the current day;
+     * unsorted input is handled correctly, but more slowly.
+     *
+     * @param ttimes Array of times
+     * @param count Number of times in the array
+     * @param isDay Output array of count bytes: 1 for day, 0 for night
+     */
+        void poll (const time_t *ttimes, const size_t count, unsigned char *isDay);
+
+    /**
+     * @brief Poll whether it is day or night for many times at once, writing a packed bitset.
+     *
+     * As poll(ttimes, count, isDay), but bit (i % 64) of isDayBits[i / 64] is set for day and cleared for night.
+     *
+     * @param ttimes Array of times
+     * @param count Number of times in the array
+     * @param isDayBits Output array of (count + 63) / 64 words
+     */
+        void pollBits (const time_t *ttimes, const size_t count, uint64_t *isDayBits);
     
     /**
      * @brief Sleep until specified event occurs (sun rise or sun set or either)
      * 
      * With a twilight angle and offset set, the corresponding event(s) will be queried.
+     * The sleep ends at the absolute (wall clock) time of the event, with sub-second precision. Steps of the clock
+     * (NTP, suspend and resume) are detected within a minute and the event is computed again; wakeLatency is set
+     * to the measured lateness.
      * 
      * @param reportSunrise When true sun rises are considered
      * @param reportSunset  When true sun sets are considered
@@ -260,6 +397,34 @@ class SunWait
      * @return Returns EXIT_OK or EXIT_ERROR
      */
         int wait (bool reportSunrise = true, bool reportSunset = true, unsigned long *waitptr = nullptr);
+
+    /**
+     * @brief Sleep until the event occurs, the token is signalled or the timeout passes
+     *
+     * As wait(), but another thread can end the wait through the token (see WaitToken). The timeout is measured on a
+     * clock which is not affected by steps of the wall clock. With a clock set, the token is only checked between
+     * the sleeps of that clock.
+     *
+     * @param reportSunrise When true sun rises are considered
+     * @param reportSunset  When true sun sets are considered
+     * @param token Cancellation token
+     * @param timeoutSeconds Longest wait in seconds (optional). By default there is no limit.
+     * @return Returns EXIT_OK at the event, EXIT_CANCELLED, EXIT_CHANGED, EXIT_TIMEOUT or EXIT_ERROR
+     */
+        int wait (bool reportSunrise, bool reportSunset, WaitToken &token, const double timeoutSeconds = 0.0);
+
+    /**
+     * @brief Find the first sun rise or set (with twilight angle and offset) after a time
+     *
+     * The events are the times at which poll() changes: the times of list(), and the start and end of
+     * polar days (which list() only marks as POLAR_DAY). The search covers about a year.
+     *
+     * @param after Time to search from; the event is strictly later
+     * @param eventTime The time of the event is written here
+     * @param isRise Set to true for a sun rise, false for a sun set (optional)
+     * @return Return true when an event was found.
+     */
+        bool next_event (const time_t after, time_t *eventTime, bool *isRise = nullptr);
     /**
      * @brief This replicates the generate report of the original sunwait command line executable
      * 
@@ -271,6 +436,43 @@ class SunWait
      * @param mday Specify the day
      */
         void generate_report (int year = NOT_SET, int mon = NOT_SET, int mday = NOT_SET);
+
+    /**
+     * @brief Compute the values of the report without printing anything
+     *
+     * Each arc is computed once; the day/night state reuses the arc of the target date when now falls on it.
+     *
+     * @param year Specify the year
+     * @param mon Specify the month
+     * @param mday Specify the day
+     * @param now Time of the day/night state (optional). By default the current time is used.
+     * @return The report
+     */
+        SunReport report (int year = NOT_SET, int mon = NOT_SET, int mday = NOT_SET, time_t now = NOT_SET);
+
+    /**
+     * @brief Compute the reports of many sites for the same date
+     *
+     * All settings of this object (ephemeris, cache, utc) apply, but the coordinates, twilight angle and offset are
+     * taken from each site. The target date and the current time are only worked out once.
+     *
+     * @param sites Array of sites
+     * @param count Number of sites
+     * @param reports Output array of count reports
+     * @param year Specify the year
+     * @param mon Specify the month
+     * @param mday Specify the day
+     * @param now Time of the day/night state (optional). By default the current time is used.
+     */
+        void report (const SunSite *sites, const size_t count, SunReport *reports, int year = NOT_SET,
+                     int mon = NOT_SET, int mday = NOT_SET, time_t now = NOT_SET);
+
+    /**
+     * @brief Print a report, as generate_report does
+     *
+     * @param report Report from report()
+     */
+        void print_report (const SunReport &report);
     
     /**
      * @brief This replicates the list command of the original sunwait executable
@@ -300,6 +502,18 @@ class SunWait
      */
         std::pair<std::vector<time_t>, std::vector<time_t>> list (const int days, const int year, const int month, int day);
 
+    /**
+     * @brief Measure the cost and accuracy of a solar position backend (see SunWait::position)
+     *
+     * Evaluates the backend at the given number of instants spread over 1900-2100, timing the evaluations and
+     * measuring how far they deviate from SUN_POSITION_NOAA. This takes about a millisecond per 10000 samples.
+     *
+     * @param position Backend
+     * @param samples Number of instants
+     * @return SunPositionInfo
+     */
+        static SunPositionInfo positionInfo (const SunPositionBackend position, const int samples = 20000);
+
     private:
 
         double        latitude = DEFAULT_LATITUDE;              // Degrees N - Global position
@@ -308,9 +522,23 @@ class SunWait
         double fixLatitude(const double x);
         double fixLongitude(const double x);
         time_t targetTime(int yearInt = NOT_SET, int monInt = NOT_SET, int mdayInt = NOT_SET);
+        SunArc riset (const unsigned long day, const double angle);
+        SunClock &source ();
+        time_t currentTime ();
+        int eventDeadline (const bool reportSunrise, const bool reportSunset, const double nowSeconds, double *deadline);
+        int sleepUntil (double deadline, const bool reportSunrise, const bool reportSunset, WaitToken *token,
+                        const unsigned long generation, const double timeoutSeconds);
+        void dayBounds (const unsigned long day, double *bounds);
+        void arcBounds (SunArc yesterday, SunArc today, SunArc tomorrow, double *bounds);
+        void fill_report (SunReport &report, const time_t targetTimet, const time_t nowTimet, const time_t nowMidnightUTC);
+        template <typename Label> void pollBatch (const time_t *ttimes, const size_t count, Label label);
 
+        UtcOffsetTable timezone (const time_t from, const time_t to);
         void print_times( const time_t   pMidnightTimet, SunArc result, const double   pOffset, const char   *pSeparator);
-        void print_a_sun_time( const time_t *pMidnightTimet, const double  pEventHour, const double  pOffsetDiurnalArc);
+        void write_times( EventWriter &writer, const time_t pMidnightTimet, SunArc result, const double pOffset,
+                          const char *pSeparator);
+        void write_a_sun_time( EventWriter &writer, const time_t pMidnightTimet, const double pEventHour,
+                               const double pOffsetDiurnalArc);
         void print_a_time(   const time_t *pMidnightTimet, const double  pEventHour);
 
         std::pair<time_t, time_t> get_times(   const time_t   pMidnightTimet, SunArc  result, const double   pOffset) ;
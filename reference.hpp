@@ -0,0 +1,2521 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#pragma once
+
+/*
+** The sun's position of the regression suite (bench regression): the periodic terms of the VSOP87 theory
+** for the heliocentric ecliptic longitude (L), latitude (B) and radius vector (R) of the earth, truncated as in
+** Meeus, Astronomical Algorithms, appendix III. Each term { amplitude, phase, frequency } adds
+** amplitude cos(phase + frequency tau), in units of 1e-8 radian (astronomical unit for R), with tau in Julian
+** millennia from J2000.0 (TT); series n is multiplied by tau^n.
+*/
+static const double cEarthL0[][3] =
+{
+    { 175347046, 0, 0 }, { 3341656, 4.6692568, 6283.07585 }, { 34894, 4.6261, 12566.1517 },
+    { 3497, 2.7441, 5753.3849 }, { 3418, 2.8289, 3.5231 }, { 3136, 3.6277, 77713.7715 },
+    { 2676, 4.4181, 7860.4194 }, { 2343, 6.1352, 3930.2097 }, { 1324, 0.7425, 11506.7698 },
+    { 1273, 2.0371, 529.691 }, { 1199, 1.1096, 1577.3435 }, { 990, 5.233, 5884.927 },
+    { 902, 2.045, 26.298 }, { 857, 3.508, 398.149 }, { 780, 1.179, 5223.694 },
+    { 753, 2.533, 5507.553 }, { 505, 4.583, 18849.228 }, { 492, 4.205, 775.523 },
+    { 357, 2.92, 0.067 }, { 317, 5.849, 11790.629 }, { 284, 1.899, 796.298 },
+    { 271, 0.315, 10977.079 }, { 243, 0.345, 5486.778 }, { 206, 4.806, 2544.314 },
+    { 205, 1.869, 5573.143 }, { 202, 2.458, 6069.777 }, { 156, 0.833, 213.299 },
+    { 132, 3.411, 2942.463 }, { 126, 1.083, 20.775 }, { 115, 0.645, 0.98 },
+    { 103, 0.636, 4694.003 }, { 102, 0.976, 15720.839 }, { 102, 4.267, 7.114 },
+    { 99, 6.21, 2146.17 }, { 98, 0.68, 155.42 }, { 86, 5.98, 161000.69 },
+    { 85, 1.3, 6275.96 }, { 85, 3.67, 71430.7 }, { 80, 1.81, 17260.15 },
+    { 79, 3.04, 12036.46 }, { 75, 1.76, 5088.63 }, { 74, 3.5, 3154.69 },
+    { 74, 4.68, 801.82 }, { 70, 0.83, 9437.76 }, { 62, 3.98, 8827.39 },
+    { 61, 1.82, 7084.9 }, { 57, 2.78, 6286.6 }, { 56, 4.39, 14143.5 },
+    { 56, 3.47, 6279.55 }, { 52, 0.19, 12139.55 }, { 52, 1.33, 1748.02 },
+    { 51, 0.28, 5856.48 }, { 49, 0.49, 1194.45 }, { 41, 5.37, 8429.24 },
+    { 41, 2.4, 19651.05 }, { 39, 6.17, 10447.39 }, { 37, 6.04, 10213.29 },
+    { 37, 2.57, 1059.38 }, { 36, 1.71, 2352.87 }, { 36, 1.78, 6812.77 },
+    { 33, 0.59, 17789.85 }, { 30, 0.44, 83996.85 }, { 30, 2.74, 1349.87 },
+    { 25, 3.16, 4690.48 }
+};
+static const double cEarthL1[][3] =
+{
+    { 628331966747.0, 0, 0 }, { 206059, 2.678235, 6283.07585 }, { 4303, 2.6351, 12566.1517 },
+    { 425, 1.59, 3.523 }, { 119, 5.796, 26.298 }, { 109, 2.966, 1577.344 },
+    { 93, 2.59, 18849.23 }, { 72, 1.14, 529.69 }, { 68, 1.87, 398.15 },
+    { 67, 4.41, 5507.55 }, { 59, 2.89, 5223.69 }, { 56, 2.17, 155.42 },
+    { 45, 0.4, 796.3 }, { 36, 0.47, 775.52 }, { 29, 2.65, 7.11 },
+    { 21, 5.34, 0.98 }, { 19, 1.85, 5486.78 }, { 19, 4.97, 213.3 },
+    { 17, 2.99, 6275.96 }, { 16, 0.03, 2544.31 }, { 16, 1.43, 2146.17 },
+    { 15, 1.21, 10977.08 }, { 12, 2.83, 1748.02 }, { 12, 3.26, 5088.63 },
+    { 12, 5.27, 1194.45 }, { 12, 2.08, 4694.0 }, { 11, 0.77, 553.57 },
+    { 10, 1.3, 6286.6 }, { 10, 4.24, 1349.87 }, { 9, 2.7, 242.73 },
+    { 9, 5.64, 951.72 }, { 8, 5.3, 2352.87 }, { 6, 2.65, 9437.76 },
+    { 6, 4.67, 4690.48 }
+};
+static const double cEarthL2[][3] =
+{
+    { 52919, 0, 0 }, { 8720, 1.0721, 6283.0758 }, { 309, 0.867, 12566.152 },
+    { 27, 0.05, 3.52 }, { 16, 5.19, 26.3 }, { 16, 3.68, 155.42 },
+    { 10, 0.76, 18849.23 }, { 9, 2.06, 77713.77 }, { 7, 0.83, 775.52 },
+    { 5, 4.66, 1577.34 }, { 4, 1.03, 7.11 }, { 4, 3.44, 5573.14 },
+    { 3, 5.14, 796.3 }, { 3, 6.05, 5507.55 }, { 3, 1.19, 242.73 },
+    { 3, 6.12, 529.69 }, { 3, 0.31, 398.15 }, { 3, 2.28, 553.57 },
+    { 2, 4.38, 5223.69 }, { 2, 3.75, 0.98 }
+};
+static const double cEarthL3[][3] =
+{
+    { 289, 5.844, 6283.076 }, { 35, 0, 0 }, { 17, 5.49, 12566.15 }, { 3, 5.2, 155.42 },
+    { 1, 4.72, 3.52 }, { 1, 5.3, 18849.23 }, { 1, 5.97, 242.73 }
+};
+static const double cEarthL4[][3] = { { 114, 3.142, 0 }, { 8, 4.13, 6283.08 }, { 1, 3.84, 12566.15 } };
+static const double cEarthL5[][3] = { { 1, 3.14, 0 } };
+
+static const double cEarthB0[][3] =
+{
+    { 280, 3.199, 84334.662 }, { 102, 5.422, 5507.553 }, { 80, 3.88, 5223.69 }, { 44, 3.7, 2352.87 },
+    { 32, 4.0, 1577.34 }
+};
+static const double cEarthB1[][3] = { { 9, 3.9, 5507.55 }, { 6, 1.73, 5223.69 } };
+
+static const double cEarthR0[][3] =
+{
+    { 100013989, 0, 0 }, { 1670700, 3.0984635, 6283.07585 }, { 13956, 3.05525, 12566.1517 },
+    { 3084, 5.1985, 77713.7715 }, { 1628, 1.1739, 5753.3849 }, { 1576, 2.8469, 7860.4194 },
+    { 925, 5.453, 11506.77 }, { 542, 4.564, 3930.21 }, { 472, 3.661, 5884.927 },
+    { 346, 0.964, 5507.553 }, { 329, 5.9, 5223.694 }, { 307, 0.299, 5573.143 },
+    { 243, 4.273, 11790.629 }, { 212, 5.847, 1577.344 }, { 186, 5.022, 10977.079 },
+    { 175, 3.012, 18849.228 }, { 110, 5.055, 5486.778 }, { 98, 0.89, 6069.78 },
+    { 86, 5.69, 15720.84 }, { 86, 1.27, 161000.69 }, { 65, 0.27, 17260.15 },
+    { 63, 0.92, 529.69 }, { 57, 2.01, 83996.85 }, { 56, 5.24, 71430.7 },
+    { 49, 3.25, 2544.31 }, { 47, 2.58, 775.52 }, { 45, 5.54, 9437.76 },
+    { 43, 6.01, 6275.96 }, { 39, 5.36, 4694.0 }, { 38, 2.39, 8827.39 },
+    { 37, 0.83, 19651.05 }, { 37, 4.9, 12139.55 }, { 36, 1.67, 12036.46 },
+    { 35, 1.84, 2942.46 }, { 33, 0.24, 7084.9 }, { 32, 0.18, 5088.63 },
+    { 32, 1.78, 398.15 }, { 28, 1.21, 6286.6 }, { 28, 1.9, 6279.55 },
+    { 26, 4.59, 10447.39 }
+};
+static const double cEarthR1[][3] =
+{
+    { 103019, 1.10749, 6283.07585 }, { 1721, 1.0644, 12566.1517 }, { 702, 3.142, 0 },
+    { 32, 1.02, 18849.23 }, { 31, 2.84, 5507.55 }, { 25, 1.32, 5223.69 },
+    { 18, 1.42, 1577.34 }, { 10, 5.91, 10977.08 }, { 9, 1.42, 6275.96 },
+    { 9, 0.27, 5486.78 }
+};
+static const double cEarthR2[][3] =
+{
+    { 4359, 5.7846, 6283.0758 }, { 124, 5.579, 12566.152 }, { 12, 3.14, 0 }, { 9, 3.63, 77713.77 },
+    { 6, 1.87, 5573.14 }, { 3, 5.47, 18849.23 }
+};
+static const double cEarthR3[][3] = { { 145, 4.273, 6283.076 }, { 7, 3.92, 12566.15 } };
+static const double cEarthR4[][3] = { { 4, 2.56, 6283.08 } };
+
+/*
+** Reference events of the regression suite (bench regression): rise and set, hours UTC after midnight of
+** the day, for the grid of sites and days of bench.cpp, days first, from the position above. Printed by
+** bench reference.
+*/
+#define REFERENCE_NO_EVENT 99.0
+
+static const double cReferenceEvents[][2] =
+{
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.518548, 21.862416 },
+    { 1.143637, 20.298245 },
+    { 99.000000, 20.193267 },
+    { 99.000000, 99.000000 },
+    { -4.186498, 10.832812 },
+    { 14.841514, 30.883311 },
+    { 11.684089, 29.104408 },
+    { 8.415474, 27.435510 },
+    { 8.780261, 22.142950 },
+    { 5.925544, 20.062465 },
+    { 2.972300, 18.080383 },
+    { 0.002333, 16.114919 },
+    { -0.489680, 11.674383 },
+    { -3.312182, 9.561802 },
+    { 15.792079, 29.536922 },
+    { 12.886886, 27.506960 },
+    { 12.235021, 23.225470 },
+    { 9.389662, 21.135810 },
+    { 6.465178, 19.125258 },
+    { 3.546128, 17.109263 },
+    { 3.141757, 12.579991 },
+    { 0.194626, 10.592150 },
+    { -2.838530, 8.690344 },
+    { 16.149220, 28.782377 },
+    { 16.312334, 23.685409 },
+    { 13.136701, 21.926153 },
+    { 9.881218, 20.246800 },
+    { 6.676607, 18.516621 },
+    { 99.000000, 99.000000 },
+    { 5.444921, 9.880109 },
+    { 1.230247, 9.160243 },
+    { -2.553774, 8.009914 },
+    { 15.542088, 30.824355 },
+    { 11.901578, 29.510916 },
+    { 6.914657, 29.309382 },
+    { 99.000000, 99.000000 },
+    { 6.466182, 20.197740 },
+    { 3.392506, 18.335286 },
+    { 0.130167, 16.658506 },
+    { -3.246573, 15.090419 },
+    { -3.064025, 10.007010 },
+    { 16.046673, 29.956406 },
+    { 13.028313, 28.040048 },
+    { 9.987232, 26.145644 },
+    { 9.343279, 21.870101 },
+    { 6.523499, 19.756709 },
+    { 3.621213, 17.725587 },
+    { 0.714251, 15.698970 },
+    { -0.329548, 11.817160 },
+    { -3.125495, 9.680270 },
+    { 16.001957, 29.613999 },
+    { 13.131759, 27.551284 },
+    { 11.984023, 23.771599 },
+    { 9.168810, 21.654266 },
+    { 6.276286, 19.614296 },
+    { 3.384794, 17.573334 },
+    { 2.353401, 13.677170 },
+    { -0.540055, 11.638483 },
+    { -3.526647, 9.693191 },
+    { 15.464685, 29.764393 },
+    { 14.743725, 25.556781 },
+    { 11.706541, 23.662598 },
+    { 8.546995, 21.891536 },
+    { 5.380487, 20.128234 },
+    { 5.509136, 15.073587 },
+    { 2.070551, 13.583385 },
+    { -1.559262, 12.287799 },
+    { -5.255855, 11.065359 },
+    { 19.829560, 26.049096 },
+    { 16.154444, 24.789399 },
+    { 12.431700, 23.575993 },
+    { 8.781917, 22.287818 },
+    { 8.440123, 17.715219 },
+    { 5.357696, 15.864065 },
+    { 2.170279, 14.117526 },
+    { -1.000219, 12.353714 },
+    { -2.025671, 8.454036 },
+    { 17.074969, 28.416518 },
+    { 14.072078, 26.486121 },
+    { 11.077121, 24.547687 },
+    { 9.642995, 21.054272 },
+    { 6.816188, 18.948208 },
+    { 3.912523, 16.919006 },
+    { 1.012088, 14.886570 },
+    { -0.590498, 11.559920 },
+    { -3.395020, 9.431812 },
+    { 15.721507, 29.378920 },
+    { 12.839963, 27.327978 },
+    { 11.162953, 24.075288 },
+    { 8.333096, 21.972860 },
+    { 5.415814, 19.958146 },
+    { 2.490089, 17.952099 },
+    { 0.791117, 14.722193 },
+    { -2.135879, 12.717925 },
+    { -5.192104, 10.843929 },
+    { 13.681656, 31.037416 },
+    { 12.237008, 27.551680 },
+    { 9.096478, 25.764538 },
+    { 5.675209, 24.265098 },
+    { 1.844280, 23.213550 },
+    { 0.552484, 19.560841 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.406164, 22.784846 },
+    { 14.181023, 22.076348 },
+    { 10.394738, 20.929154 },
+    { 9.527565, 16.859451 },
+    { 6.348402, 15.104662 },
+    { 3.091534, 13.427618 },
+    { -0.113691, 11.698966 },
+    { -1.383926, 8.033898 },
+    { 17.667060, 28.055030 },
+    { 14.634114, 26.153984 },
+    { 11.618796, 24.235320 },
+    { 9.969529, 20.949548 },
+    { 7.123620, 18.861408 },
+    { 4.199273, 16.851691 },
+    { 1.280410, 14.836486 },
+    { -0.489171, 11.671354 },
+    { -3.312040, 9.560124 },
+    { 15.788076, 29.531814 },
+    { 12.883064, 27.502670 },
+    { 11.042967, 24.408074 },
+    { 8.187790, 22.329056 },
+    { 5.234658, 20.347892 },
+    { 2.264697, 18.383473 },
+    { 0.342517, 15.370703 },
+    { -2.643676, 13.422331 },
+    { -5.802924, 11.646535 },
+    { 12.934992, 31.978024 },
+    { 11.306716, 28.672073 },
+    { 7.926793, 27.114528 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.334224, 27.688920 },
+    { 14.887896, 26.206561 },
+    { 11.258546, 24.910288 },
+    { 7.573411, 23.675360 },
+    { 7.816893, 18.464977 },
+    { 4.776903, 16.573870 },
+    { 1.617005, 14.803359 },
+    { -1.547144, 13.037805 },
+    { -2.342714, 8.889365 },
+    { 16.739246, 28.866149 },
+    { 13.752516, 26.921361 },
+    { 10.766443, 24.976115 },
+    { 9.527076, 21.275670 },
+    { 6.711082, 19.159494 },
+    { 3.818175, 17.120279 },
+    { 0.926507, 15.079859 },
+    { -0.538023, 11.607308 },
+    { -3.334655, 9.471498 },
+    { 15.790498, 29.404312 },
+    { 12.919762, 27.342524 },
+    { 11.383166, 23.942802 },
+    { 8.562536, 21.830664 },
+    { 5.659319, 19.800882 },
+    { 2.751092, 17.775943 },
+    { 1.223011, 14.367148 },
+    { -1.685990, 12.342558 },
+    { -4.708455, 10.430674 },
+    { 14.263356, 30.514276 },
+    { 12.994246, 26.847760 },
+    { 9.916176, 24.990096 },
+    { 6.644970, 23.322512 },
+    { 3.249082, 21.773475 },
+    { 2.209494, 17.874490 },
+    { -1.483541, 16.610891 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.409350, 32.123341 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.296177, 20.449336 },
+    { 2.167074, 18.650361 },
+    { -1.227843, 17.123674 },
+    { -4.959525, 15.962196 },
+    { -3.921723, 9.923199 },
+    { 15.134782, 29.934256 },
+    { 12.081769, 28.056735 },
+    { 8.986989, 26.222288 },
+    { 8.691169, 21.569533 },
+    { 5.862901, 19.465188 },
+    { 2.947536, 17.448242 },
+    { 0.024211, 15.439482 },
+    { -0.814062, 11.337317 },
+    { -3.617479, 9.207768 },
+    { 15.501595, 29.155018 },
+    { 12.621171, 27.102617 },
+    { 11.670731, 23.114767 },
+    { 8.845044, 21.007226 },
+    { 5.942235, 18.976813 },
+    { 3.042483, 16.943337 },
+    { 2.247741, 12.800167 },
+    { -0.663923, 10.778313 },
+    { -3.664949, 8.845683 },
+    { 15.356397, 28.889872 },
+    { 14.956758, 24.352481 },
+    { 11.878557, 22.496682 },
+    { 8.693498, 20.747340 },
+    { 5.523441, 18.982604 },
+    { 6.461284, 13.105760 },
+    { 2.829358, 11.802312 },
+    { -0.875853, 10.570627 },
+    { -4.525130, 9.280882 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.521181, 21.860448 },
+    { 1.147021, 20.295501 },
+    { 99.000000, 20.124465 },
+    { 99.000000, 99.000000 },
+    { -4.185008, 10.832094 },
+    { 14.843146, 30.882334 },
+    { 11.685975, 29.103176 },
+    { 8.417832, 27.433795 },
+    { 8.781105, 22.142837 },
+    { 5.926448, 20.062303 },
+    { 2.973286, 18.080148 },
+    { 0.003420, 16.114592 },
+    { -0.489254, 11.674759 },
+    { -3.311709, 9.562143 },
+    { 15.792553, 29.537150 },
+    { 12.887422, 27.507138 },
+    { 12.234969, 23.226268 },
+    { 9.389669, 21.136563 },
+    { 6.465246, 19.125963 },
+    { 3.546252, 17.109926 },
+    { 3.141129, 12.581434 },
+    { 0.194102, 10.593503 },
+    { -2.838957, 8.691615 },
+    { 16.148758, 28.783573 },
+    { 16.310604, 23.687899 },
+    { 13.135283, 21.928348 },
+    { 9.880028, 20.248782 },
+    { 6.675556, 18.518480 },
+    { 99.000000, 99.000000 },
+    { 5.439646, 9.886244 },
+    { 1.227245, 9.164125 },
+    { -2.556177, 8.013220 },
+    { 15.552971, 30.811717 },
+    { 11.915389, 29.495587 },
+    { 6.977837, 29.265993 },
+    { 99.000000, 99.000000 },
+    { 6.470980, 20.191101 },
+    { 3.397698, 18.328278 },
+    { 0.136210, 16.650692 },
+    { -3.238763, 15.080942 },
+    { -3.061618, 10.002784 },
+    { 16.049169, 29.952011 },
+    { 13.031063, 28.035416 },
+    { 9.990365, 26.140651 },
+    { 9.343778, 21.867723 },
+    { 6.524070, 19.754272 },
+    { 3.621889, 17.723058 },
+    { 0.715060, 15.696321 },
+    { -0.330446, 11.816219 },
+    { -3.126341, 9.679287 },
+    { 16.001123, 29.612922 },
+    { 13.130990, 27.550155 },
+    { 11.981685, 23.772045 },
+    { 9.166525, 21.654671 },
+    { 6.274048, 19.614667 },
+    { 3.382586, 17.573688 },
+    { 2.349229, 13.679495 },
+    { -0.544148, 11.640742 },
+    { -3.530700, 9.695425 },
+    { 15.460553, 29.766624 },
+    { 14.737196, 25.561418 },
+    { 11.700166, 23.667096 },
+    { 8.540637, 21.896035 },
+    { 5.373955, 20.132930 },
+    { 5.497031, 15.083867 },
+    { 2.059133, 13.593007 },
+    { -1.570790, 12.297580 },
+    { -5.268749, 11.076624 },
+    { 19.841567, 26.036907 },
+    { 16.163866, 24.779808 },
+    { 12.440035, 23.567511 },
+    { 8.790142, 22.279483 },
+    { 8.444925, 17.710216 },
+    { 5.362164, 15.859402 },
+    { 2.174521, 14.113098 },
+    { -0.996046, 12.349365 },
+    { -2.023007, 8.451166 },
+    { 17.077452, 28.413808 },
+    { 14.074450, 26.483529 },
+    { 11.079430, 24.545164 },
+    { 9.644043, 21.052993 },
+    { 6.817162, 18.947006 },
+    { 3.913418, 16.917888 },
+    { 1.012916, 14.885522 },
+    { -0.590627, 11.559820 },
+    { -3.395217, 9.431783 },
+    { 15.721208, 29.378971 },
+    { 12.839569, 27.328126 },
+    { 11.161628, 24.076361 },
+    { 8.331676, 21.974031 },
+    { 5.414251, 19.959462 },
+    { 2.488351, 17.953592 },
+    { 0.788158, 14.724902 },
+    { -2.139053, 12.720852 },
+    { -5.195650, 10.847233 },
+    { 13.677552, 31.041261 },
+    { 12.231771, 27.556650 },
+    { 9.090538, 25.770224 },
+    { 5.667538, 24.272569 },
+    { 1.829494, 23.229049 },
+    { 0.537759, 19.575674 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.401680, 22.791344 },
+    { 14.178756, 22.080646 },
+    { 10.393047, 20.932896 },
+    { 9.526658, 16.862374 },
+    { 6.347783, 15.107308 },
+    { 3.091124, 13.430068 },
+    { -0.113973, 11.701302 },
+    { -1.383845, 8.035860 },
+    { 17.667133, 28.056918 },
+    { 14.634279, 26.155791 },
+    { 11.619032, 24.237068 },
+    { 9.970126, 20.950928 },
+    { 7.124270, 18.862745 },
+    { 4.199978, 16.852983 },
+    { 1.281165, 14.837736 },
+    { -0.488149, 11.672337 },
+    { -3.310974, 9.561073 },
+    { 15.789151, 29.532670 },
+    { 12.884194, 27.503478 },
+    { 11.044374, 24.408605 },
+    { 8.189252, 22.329540 },
+    { 5.236194, 20.348307 },
+    { 2.266324, 18.383801 },
+    { 0.344512, 15.370659 },
+    { -2.641559, 13.422167 },
+    { -5.800586, 11.646144 },
+    { 12.937812, 31.977041 },
+    { 11.309790, 28.670840 },
+    { 7.930579, 27.112551 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.321994, 27.700071 },
+    { 14.876471, 26.216932 },
+    { 11.247106, 24.920722 },
+    { 7.560723, 23.687150 },
+    { 7.810557, 18.470236 },
+    { 4.770750, 16.578959 },
+    { 1.610902, 14.808414 },
+    { -1.553389, 13.043023 },
+    { -2.346601, 8.892200 },
+    { 16.735403, 28.868877 },
+    { 13.748720, 26.924052 },
+    { 10.762633, 24.978833 },
+    { 9.525085, 21.276562 },
+    { 6.709148, 19.160339 },
+    { 3.816294, 17.121080 },
+    { 0.924665, 15.080633 },
+    { -0.538535, 11.606753 },
+    { -3.335109, 9.470896 },
+    { 15.790070, 29.403619 },
+    { 12.919404, 27.341770 },
+    { 11.384099, 23.940759 },
+    { 8.563545, 21.828555 },
+    { 5.660443, 19.798671 },
+    { 2.752360, 17.773599 },
+    { 1.225910, 14.363179 },
+    { -1.682931, 12.338442 },
+    { -4.705112, 10.426290 },
+    { 14.267062, 30.509471 },
+    { 12.999640, 26.841270 },
+    { 9.922001, 24.983198 },
+    { 6.651733, 23.314718 },
+    { 3.257840, 21.763797 },
+    { 2.221510, 17.861546 },
+    { -1.467807, 16.594527 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.395062, 32.137045 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.290622, 20.453954 },
+    { 2.160860, 18.655648 },
+    { -1.235615, 17.130568 },
+    { -4.972703, 15.975063 },
+    { -3.925035, 9.925561 },
+    { 15.131296, 29.936818 },
+    { 12.077923, 28.059656 },
+    { 8.982595, 26.225761 },
+    { 8.689498, 21.570273 },
+    { 5.861133, 19.466024 },
+    { 2.945628, 17.449214 },
+    { 0.022132, 15.440623 },
+    { -0.814546, 11.336866 },
+    { -3.618035, 9.207387 },
+    { 15.500962, 29.154741 },
+    { 12.620444, 27.102429 },
+    { 11.671435, 23.113150 },
+    { 8.845671, 21.005683 },
+    { 5.942783, 18.975348 },
+    { 3.042965, 16.941936 },
+    { 2.250039, 12.796954 },
+    { -0.661756, 10.775230 },
+    { -3.662888, 8.842707 },
+    { 15.358377, 28.887005 },
+    { 14.961180, 24.347172 },
+    { 11.882656, 22.491697 },
+    { 8.697383, 20.742570 },
+    { 5.527270, 18.977896 },
+    { 6.472478, 13.093695 },
+    { 2.838342, 11.792465 },
+    { -0.867802, 10.561733 },
+    { -4.517077, 9.272021 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.503601, 21.862427 },
+    { 1.126358, 20.300837 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { -4.197621, 10.828663 },
+    { 14.829625, 30.880001 },
+    { 11.671419, 29.101963 },
+    { 8.401326, 27.434696 },
+    { 8.771033, 22.136762 },
+    { 5.916158, 20.056449 },
+    { 2.962683, 18.074620 },
+    { -0.007570, 16.109472 },
+    { -0.497471, 11.666656 },
+    { -3.320097, 9.554205 },
+    { 15.783990, 29.529537 },
+    { 12.878622, 27.499759 },
+    { 12.228683, 23.216232 },
+    { 9.383154, 21.126742 },
+    { 6.458488, 19.116372 },
+    { 3.539277, 17.100540 },
+    { 3.137320, 12.568759 },
+    { 0.189859, 10.581243 },
+    { -2.843597, 8.679732 },
+    { 16.144215, 28.771729 },
+    { 16.311512, 23.670498 },
+    { 13.134842, 21.912268 },
+    { 9.878603, 20.233656 },
+    { 6.673531, 18.503919 },
+    { 99.000000, 99.000000 },
+    { 5.455562, 9.853557 },
+    { 1.233414, 9.141127 },
+    { -2.552574, 7.992712 },
+    { 15.487348, 30.880318 },
+    { 11.832762, 29.579906 },
+    { 99.000000, 29.540418 },
+    { 99.000000, 99.000000 },
+    { 6.440251, 20.225332 },
+    { 3.364765, 18.364612 },
+    { 0.098423, 16.691677 },
+    { -3.286709, 15.131552 },
+    { -3.078672, 10.023301 },
+    { 16.031442, 29.973423 },
+    { 13.011904, 28.058197 },
+    { 9.969037, 26.165516 },
+    { 9.337445, 21.877689 },
+    { 6.517362, 19.764573 },
+    { 3.614599, 17.733898 },
+    { 0.707027, 15.707859 },
+    { -0.328794, 11.818073 },
+    { -3.124963, 9.681379 },
+    { 16.002314, 29.615436 },
+    { 13.131825, 27.552983 },
+    { 11.991432, 23.765940 },
+    { 9.175998, 21.648801 },
+    { 6.283266, 19.609011 },
+    { 3.391638, 17.568153 },
+    { 2.369410, 13.662796 },
+    { -0.524395, 11.624426 },
+    { -3.511172, 9.679283 },
+    { 15.480457, 29.750325 },
+    { 14.770736, 25.531452 },
+    { 11.732841, 23.637934 },
+    { 8.573187, 21.866916 },
+    { 5.407459, 20.102748 },
+    { 5.562298, 15.021864 },
+    { 2.120403, 13.534860 },
+    { -1.509049, 12.238686 },
+    { -5.199530, 11.009587 },
+    { 19.775105, 26.107295 },
+    { 16.111892, 24.835670 },
+    { 12.394164, 23.617186 },
+    { 8.744862, 22.328405 },
+    { 8.419170, 17.740109 },
+    { 5.338341, 15.887360 },
+    { 2.151999, 14.139742 },
+    { -1.018164, 12.375580 },
+    { -2.036547, 8.468978 },
+    { 17.064776, 28.430621 },
+    { 14.062431, 26.499686 },
+    { 11.067786, 24.560946 },
+    { 9.639571, 21.061712 },
+    { 6.813145, 18.955282 },
+    { 3.909871, 16.925703 },
+    { 1.009767, 14.892949 },
+    { -0.588347, 11.561890 },
+    { -3.392517, 9.433448 },
+    { 15.724361, 29.380055 },
+    { 12.843268, 27.328676 },
+    { 11.170619, 24.071677 },
+    { 8.341241, 21.968788 },
+    { 5.424633, 19.953416 },
+    { 2.499734, 17.946557 },
+    { 0.806464, 14.710996 },
+    { -2.119509, 12.705717 },
+    { -5.174002, 10.829993 },
+    { 13.702284, 31.020774 },
+    { 12.262930, 27.529797 },
+    { 9.125680, 25.739329 },
+    { 5.712345, 24.231693 },
+    { 1.912935, 23.144643 },
+    { 0.621807, 19.493825 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.419605, 22.769735 },
+    { 14.188644, 22.067019 },
+    { 10.400837, 20.921298 },
+    { 9.531663, 16.853781 },
+    { 6.351762, 15.099716 },
+    { 3.094356, 13.423193 },
+    { -0.111200, 11.694852 },
+    { -1.382344, 8.030775 },
+    { 17.668701, 28.051918 },
+    { 14.635517, 26.151100 },
+    { 11.620017, 24.232605 },
+    { 9.969829, 20.947813 },
+    { 7.123795, 18.859792 },
+    { 4.199315, 16.850203 },
+    { 1.280333, 14.835112 },
+    { -0.489907, 11.670680 },
+    { -3.312867, 9.559540 },
+    { 15.787148, 29.531411 },
+    { 12.882006, 27.502396 },
+    { 11.041212, 24.408535 },
+    { 8.185919, 22.329637 },
+    { 5.232618, 20.348654 },
+    { 2.262450, 18.384459 },
+    { 0.339369, 15.372649 },
+    { -2.647088, 13.424574 },
+    { -5.806842, 11.649349 },
+    { 12.929622, 31.982486 },
+    { 11.300718, 28.677177 },
+    { 7.919058, 27.121572 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.386792, 27.644915 },
+    { 14.937008, 26.165918 },
+    { 11.307601, 24.869515 },
+    { 7.627402, 23.629213 },
+    { 7.845100, 18.445427 },
+    { 4.804329, 16.555066 },
+    { 1.644207, 14.784729 },
+    { -1.519380, 13.018545 },
+    { -2.324556, 8.879866 },
+    { 16.757158, 28.856985 },
+    { 13.770233, 26.912364 },
+    { 10.784215, 24.967031 },
+    { 9.537410, 21.274091 },
+    { 6.721182, 19.158131 },
+    { 3.828061, 17.119109 },
+    { 0.936247, 15.078814 },
+    { -0.533718, 11.611726 },
+    { -3.330577, 9.476127 },
+    { 15.794371, 29.409239 },
+    { 12.923351, 27.347715 },
+    { 11.381473, 23.953288 },
+    { 8.560538, 21.841438 },
+    { 5.656865, 19.812093 },
+    { 2.748058, 17.787712 },
+    { 1.213313, 14.385587 },
+    { -1.696338, 12.361623 },
+    { -4.719959, 10.450861 },
+    { 14.250196, 30.536180 },
+    { 12.974190, 26.876569 },
+    { 9.894336, 25.020628 },
+    { 6.619238, 23.356799 },
+    { 3.215008, 21.815696 },
+    { 2.162158, 17.930045 },
+    { -1.546651, 16.681026 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.477950, 32.052560 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.321613, 20.423574 },
+    { 2.195743, 18.621322 },
+    { -1.191506, 17.086710 },
+    { -4.897274, 15.896606 },
+    { -3.907513, 9.908824 },
+    { 15.149811, 29.918821 },
+    { 12.098592, 28.039514 },
+    { 9.006541, 26.202322 },
+    { 8.697109, 21.563271 },
+    { 5.869321, 19.458474 },
+    { 2.954656, 17.440852 },
+    { 0.032188, 15.431258 },
+    { -0.814052, 11.337082 },
+    { -3.617118, 9.207210 },
+    { 15.502279, 29.153899 },
+    { 12.622326, 27.101051 },
+    { 11.664715, 23.120385 },
+    { 8.839409, 21.012488 },
+    { 5.937006, 18.981694 },
+    { 3.037593, 16.947901 },
+    { 2.233770, 12.813818 },
+    { -0.677247, 10.791339 },
+    { -3.677729, 8.858184 },
+    { 15.343913, 28.901826 },
+    { 14.932056, 24.376662 },
+    { 11.855452, 22.519280 },
+    { 8.671463, 20.768871 },
+    { 5.501691, 19.003843 },
+    { 6.403037, 13.163485 },
+    { 2.781896, 11.849233 },
+    { -0.918717, 10.612888 },
+    { -4.568063, 9.323071 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.506874, 21.861303 },
+    { 1.130341, 20.298951 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { -4.195488, 10.828724 },
+    { 14.831975, 30.879869 },
+    { 11.674002, 29.101576 },
+    { 8.404353, 27.433832 },
+    { 8.772598, 22.137446 },
+    { 5.917768, 20.057079 },
+    { 2.964361, 18.075173 },
+    { -0.005806, 16.109928 },
+    { -0.496344, 11.667778 },
+    { -3.318936, 9.555286 },
+    { 15.785223, 29.530577 },
+    { 12.879904, 27.500744 },
+    { 12.229395, 23.217805 },
+    { 9.383912, 21.128264 },
+    { 6.459295, 19.117840 },
+    { 3.540128, 17.101960 },
+    { 3.137447, 12.570916 },
+    { 0.190077, 10.583305 },
+    { -2.843296, 8.681707 },
+    { 16.144542, 28.773710 },
+    { 16.310611, 23.673720 },
+    { 13.134234, 21.915195 },
+    { 9.878208, 20.236368 },
+    { 6.673262, 18.506504 },
+    { 99.000000, 99.000000 },
+    { 5.451182, 9.860271 },
+    { 1.231250, 9.145627 },
+    { -2.554167, 7.996646 },
+    { 15.499679, 30.867566 },
+    { 11.848349, 29.564134 },
+    { 6.584997, 29.482369 },
+    { 99.000000, 99.000000 },
+    { 6.446023, 20.219013 },
+    { 3.370949, 18.357891 },
+    { 0.105517, 16.684074 },
+    { -3.277695, 15.122119 },
+    { -3.075470, 10.019528 },
+    { 16.034809, 29.969507 },
+    { 13.015536, 28.054020 },
+    { 9.973072, 26.160944 },
+    { 9.338673, 21.875900 },
+    { 6.518657, 19.762717 },
+    { 3.615999, 17.731938 },
+    { 0.708561, 15.705764 },
+    { -0.329069, 11.817781 },
+    { -3.125191, 9.681038 },
+    { 16.002154, 29.615045 },
+    { 13.131728, 27.552530 },
+    { 11.989669, 23.767151 },
+    { 9.174283, 21.649963 },
+    { 6.281595, 19.610128 },
+    { 3.389995, 17.569244 },
+    { 2.365688, 13.665966 },
+    { -0.528039, 11.627518 },
+    { -3.514777, 9.682336 },
+    { 15.476813, 29.753439 },
+    { 14.764539, 25.537118 },
+    { 11.726807, 23.643441 },
+    { 8.567178, 21.872407 },
+    { 5.401274, 20.108428 },
+    { 5.550156, 15.033506 },
+    { 2.109029, 13.545753 },
+    { -1.520490, 12.249690 },
+    { -5.212323, 11.022059 },
+    { 19.787996, 26.095013 },
+    { 16.122158, 24.826015 },
+    { 12.403317, 23.608654 },
+    { 8.753916, 22.319996 },
+    { 8.424586, 17.735244 },
+    { 5.343402, 15.882846 },
+    { 2.156817, 14.135467 },
+    { -1.013421, 12.371379 },
+    { -2.033400, 8.466338 },
+    { 17.067789, 28.428179 },
+    { 14.065320, 26.497363 },
+    { 11.070604, 24.558690 },
+    { 9.641055, 21.060766 },
+    { 6.814543, 18.954415 },
+    { 3.911180, 16.924918 },
+    { 1.010999, 14.892234 },
+    { -0.588125, 11.562166 },
+    { -3.392374, 9.433795 },
+    { 15.724441, 29.380528 },
+    { 12.843245, 27.329246 },
+    { 11.169612, 24.073216 },
+    { 8.340126, 21.970427 },
+    { 5.423365, 19.955201 },
+    { 2.498279, 17.948522 },
+    { 0.803724, 14.714233 },
+    { -2.122478, 12.709177 },
+    { -5.177361, 10.833837 },
+    { 13.698376, 31.025237 },
+    { 12.257826, 27.535442 },
+    { 9.119846, 25.745710 },
+    { 5.704748, 24.239893 },
+    { 1.898487, 23.160532 },
+    { 0.607063, 19.509477 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.415947, 22.776199 },
+    { 14.187039, 22.071440 },
+    { 10.399761, 20.925204 },
+    { 9.531304, 16.856929 },
+    { 6.351662, 15.102609 },
+    { 3.094443, 13.425904 },
+    { -0.111000, 11.697456 },
+    { -1.381813, 8.033030 },
+    { 17.669243, 28.054133 },
+    { 14.636140, 26.153239 },
+    { 11.620702, 24.234688 },
+    { 9.970843, 20.949554 },
+    { 7.124853, 18.861492 },
+    { 4.200420, 16.851859 },
+    { 1.281479, 14.836728 },
+    { -0.488519, 11.672047 },
+    { -3.311445, 9.560874 },
+    { 15.788605, 29.532680 },
+    { 12.883510, 27.503620 },
+    { 11.042967, 24.409501 },
+    { 8.187718, 22.330560 },
+    { 5.234482, 20.349511 },
+    { 2.264392, 18.385235 },
+    { 0.341644, 15.373080 },
+    { -2.644709, 13.424894 },
+    { -5.804268, 11.649460 },
+    { 12.932674, 31.982064 },
+    { 11.304000, 28.676524 },
+    { 7.922984, 27.120233 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.374685, 27.656293 },
+    { 14.925754, 26.176473 },
+    { 11.296376, 24.880090 },
+    { 7.614999, 23.641070 },
+    { 7.838943, 18.450880 },
+    { 4.798364, 16.560342 },
+    { 1.638302, 14.789965 },
+    { -1.525416, 13.023935 },
+    { -2.328252, 8.882896 },
+    { 16.753501, 28.859884 },
+    { 13.766628, 26.915226 },
+    { 10.780602, 24.969917 },
+    { 9.535609, 21.275164 },
+    { 6.719441, 19.159158 },
+    { 3.826377, 17.120092 },
+    { 0.934604, 15.079771 },
+    { -0.534032, 11.611359 },
+    { -3.330832, 9.475714 },
+    { 15.794133, 29.408716 },
+    { 12.923188, 27.347131 },
+    { 11.382599, 23.951424 },
+    { 8.561743, 21.839508 },
+    { 5.658189, 19.810060 },
+    { 2.749530, 17.785545 },
+    { 1.216415, 14.381800 },
+    { -1.693071, 12.357687 },
+    { -4.716400, 10.446651 },
+    { 14.254114, 30.531529 },
+    { 12.979790, 26.870245 },
+    { 9.900382, 25.013886 },
+    { 6.626252, 23.349135 },
+    { 3.224097, 21.806077 },
+    { 2.174481, 17.917189 },
+    { -1.530379, 16.664549 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.463711, 32.066054 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.315973, 20.428205 },
+    { 2.189455, 18.626616 },
+    { -1.199323, 17.093585 },
+    { -4.910185, 15.909071 },
+    { -3.910876, 9.911202 },
+    { 15.146252, 29.921349 },
+    { 12.094678, 28.042404 },
+    { 9.002085, 26.205766 },
+    { 8.695394, 21.563982 },
+    { 5.867514, 19.459282 },
+    { 2.952714, 17.441801 },
+    { 0.030079, 15.432380 },
+    { -0.814547, 11.336605 },
+    { -3.617679, 9.206804 },
+    { 15.501609, 29.153557 },
+    { 12.621568, 27.100803 },
+    { 11.665406, 23.118702 },
+    { 8.840030, 21.010882 },
+    { 5.937553, 18.980169 },
+    { 3.038080, 16.946443 },
+    { 2.236095, 12.810536 },
+    { -0.675045, 10.788188 },
+    { -3.675627, 8.855141 },
+    { 15.345899, 28.898858 },
+    { 14.936501, 24.371248 },
+    { 11.859587, 22.514186 },
+    { 8.675397, 20.763990 },
+    { 5.505581, 18.999020 },
+    { 6.414240, 13.151369 },
+    { 2.790973, 11.839260 },
+    { -0.910535, 10.603838 },
+    { -4.559837, 9.314021 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.508681, 21.859309 },
+    { 1.132761, 20.296314 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { -4.194616, 10.827782 },
+    { 14.832964, 30.878686 },
+    { 11.675200, 29.100183 },
+    { 8.405939, 27.432037 },
+    { 8.772940, 22.136990 },
+    { 5.918160, 20.056586 },
+    { 2.964821, 18.074620 },
+    { -0.005263, 16.109301 },
+    { -0.496338, 11.667733 },
+    { -3.318889, 9.555214 },
+    { 15.785257, 29.530400 },
+    { 12.879991, 27.500526 },
+    { 12.229000, 23.218104 },
+    { 9.383566, 21.128527 },
+    { 6.459003, 19.118064 },
+    { 3.539884, 17.102149 },
+    { 3.136590, 12.571749 },
+    { 0.189310, 10.584064 },
+    { -2.843981, 8.682399 },
+    { 16.143804, 28.774339 },
+    { 16.308826, 23.675424 },
+    { 13.132712, 21.916651 },
+    { 9.876880, 20.237648 },
+    { 6.672055, 18.507680 },
+    { 99.000000, 99.000000 },
+    { 5.446498, 9.864977 },
+    { 1.228459, 9.148462 },
+    { -2.556457, 7.999005 },
+    { 15.509496, 30.855085 },
+    { 11.861053, 29.548998 },
+    { 6.696159, 29.432865 },
+    { 99.000000, 99.000000 },
+    { 6.450050, 20.212247 },
+    { 3.375356, 18.350769 },
+    { 0.110743, 16.676175 },
+    { -3.270755, 15.112606 },
+    { -3.073700, 10.015046 },
+    { 16.036667, 29.964856 },
+    { 13.017637, 28.049142 },
+    { 9.975540, 26.155720 },
+    { 9.338644, 21.873158 },
+    { 6.518697, 19.759918 },
+    { 3.616140, 17.729050 },
+    { 0.708831, 15.702762 },
+    { -0.330413, 11.816396 },
+    { -3.126482, 9.679612 },
+    { 16.000872, 29.613527 },
+    { 13.130509, 27.550962 },
+    { 11.986967, 23.767072 },
+    { 9.171633, 21.649844 },
+    { 6.278991, 19.609976 },
+    { 3.387422, 17.569073 },
+    { 2.361262, 13.667658 },
+    { -0.532387, 11.629145 },
+    { -3.519084, 9.683937 },
+    { 15.472428, 29.755037 },
+    { 14.757882, 25.540996 },
+    { 11.720303, 23.647182 },
+    { 8.560699, 21.876140 },
+    { 5.394642, 20.112337 },
+    { 5.538219, 15.042733 },
+    { 2.097778, 13.554322 },
+    { -1.531806, 12.258373 },
+    { -5.224860, 11.032073 },
+    { 19.799595, 26.082611 },
+    { 16.131255, 24.816127 },
+    { 12.411358, 23.599842 },
+    { 8.761868, 22.311308 },
+    { 8.429075, 17.729924 },
+    { 5.347561, 15.877860 },
+    { 2.160753, 14.130711 },
+    { -1.009551, 12.366697 },
+    { -2.031053, 8.463147 },
+    { 17.069968, 28.425154 },
+    { 14.067387, 26.494454 },
+    { 11.072608, 24.555846 },
+    { 9.641790, 21.059172 },
+    { 6.815204, 18.952897 },
+    { 3.911760, 16.923483 },
+    { 1.011512, 14.890867 },
+    { -0.588574, 11.561751 },
+    { -3.392892, 9.433450 },
+    { 15.723830, 29.380272 },
+    { 12.842540, 27.329084 },
+    { 11.167970, 24.073983 },
+    { 8.338388, 21.971291 },
+    { 5.421484, 19.956207 },
+    { 2.496224, 17.949704 },
+    { 0.800441, 14.716634 },
+    { -2.125974, 12.711792 },
+    { -5.181226, 10.836824 },
+    { 13.693965, 31.028770 },
+    { 12.252272, 27.540107 },
+    { 9.113600, 25.751080 },
+    { 5.696809, 24.247007 },
+    { 1.883884, 23.175112 },
+    { 0.592238, 19.523763 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.412010, 22.781728 },
+    { 14.185026, 22.075060 },
+    { 10.398249, 20.928341 },
+    { 9.530461, 16.859357 },
+    { 6.351068, 15.104798 },
+    { 3.094029, 13.427923 },
+    { -0.111302, 11.699375 },
+    { -1.381807, 8.034627 },
+    { 17.669231, 28.055684 },
+    { 14.636208, 26.154718 },
+    { 11.620831, 24.236114 },
+    { 9.971281, 20.950663 },
+    { 7.125336, 18.862563 },
+    { 4.200950, 16.852890 },
+    { 1.282053, 14.837724 },
+    { -0.487720, 11.672813 },
+    { -3.310609, 9.561611 },
+    { 15.789450, 29.533340 },
+    { 12.884402, 27.504239 },
+    { 11.044094, 24.409881 },
+    { 8.188892, 22.330898 },
+    { 5.235717, 20.349791 },
+    { 2.265704, 18.385441 },
+    { 0.343265, 15.372968 },
+    { -2.642987, 13.424680 },
+    { -5.802363, 11.649054 },
+    { 12.935011, 31.981131 },
+    { 11.306551, 28.675378 },
+    { 7.926137, 27.118444 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.362540, 27.667249 },
+    { 14.914434, 26.186624 },
+    { 11.285073, 24.890266 },
+    { 7.602523, 23.652521 },
+    { 7.832624, 18.455984 },
+    { 4.792230, 16.565270 },
+    { 1.632222, 14.794850 },
+    { -1.531630, 13.028970 },
+    { -2.332167, 8.885598 },
+    { 16.749647, 28.862508 },
+    { 13.762821, 26.917809 },
+    { 10.776781, 24.972520 },
+    { 9.533567, 21.275971 },
+    { 6.717454, 19.159914 },
+    { 3.824442, 17.120802 },
+    { 0.932704, 15.080450 },
+    { -0.534630, 11.610731 },
+    { -3.331376, 9.475036 },
+    { 15.793637, 29.407971 },
+    { 12.922760, 27.346322 },
+    { 11.383436, 23.949346 },
+    { 8.562652, 21.837362 },
+    { 5.659207, 19.807808 },
+    { 2.750688, 17.783159 },
+    { 1.219170, 14.377817 },
+    { -1.690160, 12.353555 },
+    { -4.713210, 10.442249 },
+    { 14.257695, 30.526723 },
+    { 12.985022, 26.863785 },
+    { 9.906040, 25.007014 },
+    { 6.632848, 23.341361 },
+    { 3.232702, 21.796396 },
+    { 2.186261, 17.904315 },
+    { -1.514792, 16.648165 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.449224, 32.080573 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.310441, 20.433375 },
+    { 2.183242, 18.632472 },
+    { -1.207134, 17.101087 },
+    { -4.923346, 15.922463 },
+    { -3.914070, 9.913989 },
+    { 15.142899, 29.924376 },
+    { 12.090948, 28.045801 },
+    { 8.997784, 26.209733 },
+    { 8.693939, 21.565081 },
+    { 5.865953, 19.460477 },
+    { 2.951005, 17.443136 },
+    { 0.028189, 15.433887 },
+    { -0.814769, 11.336436 },
+    { -3.617978, 9.206704 },
+    { 15.501255, 29.153591 },
+    { 12.621114, 27.100928 },
+    { 11.666454, 23.117320 },
+    { 8.840993, 21.009575 },
+    { 5.938429, 18.978939 },
+    { 3.038884, 16.945278 },
+    { 2.238802, 12.807465 },
+    { -0.672478, 10.785249 },
+    { -3.673174, 8.852309 },
+    { 15.348300, 28.896159 },
+    { 14.941458, 24.365986 },
+    { 11.864205, 22.509257 },
+    { 8.679790, 20.759281 },
+    { 5.509916, 18.994369 },
+    { 6.426189, 13.139103 },
+    { 2.800675, 11.829242 },
+    { -0.901785, 10.594784 },
+    { -4.551065, 9.304974 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.510852, 21.857548 },
+    { 1.135557, 20.293875 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { -4.193466, 10.827083 },
+    { 14.834315, 30.877820 },
+    { 11.676758, 29.099088 },
+    { 8.407889, 27.430513 },
+    { 8.773587, 22.136851 },
+    { 5.918845, 20.056399 },
+    { 2.965567, 18.074364 },
+    { -0.004442, 16.108959 },
+    { -0.496082, 11.667983 },
+    { -3.318605, 9.555428 },
+    { 15.785609, 29.530587 },
+    { 12.880385, 27.500662 },
+    { 12.228886, 23.218763 },
+    { 9.383491, 21.129141 },
+    { 6.458971, 19.118628 },
+    { 3.539891, 17.102669 },
+    { 3.135954, 12.572925 },
+    { 0.188753, 10.585156 },
+    { -2.844463, 8.683411 },
+    { 16.143345, 28.775372 },
+    { 16.307270, 23.677562 },
+    { 13.131416, 21.918525 },
+    { 9.875774, 20.239329 },
+    { 6.671062, 18.509246 },
+    { 99.000000, 99.000000 },
+    { 5.441854, 9.870208 },
+    { 1.225780, 9.151730 },
+    { -2.558626, 8.001768 },
+    { 15.519884, 30.842549 },
+    { 11.874344, 29.533758 },
+    { 6.784849, 29.384751 },
+    { 99.000000, 99.000000 },
+    { 6.454450, 20.205585 },
+    { 3.380125, 18.343744 },
+    { 0.116334, 16.668352 },
+    { -3.263438, 15.103133 },
+    { -3.071655, 10.010713 },
+    { 16.038874, 29.960399 },
+    { 13.020081, 28.044448 },
+    { 9.978347, 26.150665 },
+    { 9.338889, 21.870646 },
+    { 6.519001, 19.757344 },
+    { 3.616537, 17.726380 },
+    { 0.709349, 15.699969 },
+    { -0.331549, 11.815250 },
+    { -3.127575, 9.678421 },
+    { 15.999847, 29.612305 },
+    { 13.129539, 27.549681 },
+    { 11.984473, 23.767311 },
+    { 9.169182, 21.650038 },
+    { 6.276578, 19.610128 },
+    { 3.385032, 17.569200 },
+    { 2.356972, 13.669684 },
+    { -0.536607, 11.631099 },
+    { -3.523269, 9.685856 },
+    { 15.468207, 29.757034 },
+    { 14.751329, 25.545322 },
+    { 11.713896, 23.651363 },
+    { 8.554311, 21.880308 },
+    { 5.388088, 20.116681 },
+    { 5.526240, 15.052504 },
+    { 2.086485, 13.563423 },
+    { -1.543177, 12.267593 },
+    { -5.237501, 11.042672 },
+    { 19.812023, 26.070157 },
+    { 16.141040, 24.806306 },
+    { 12.420018, 23.591145 },
+    { 8.770406, 22.302745 },
+    { 8.434060, 17.724825 },
+    { 5.352187, 15.873106 },
+    { 2.165133, 14.126192 },
+    { -1.005256, 12.362253 },
+    { -2.028319, 8.460225 },
+    { 17.072610, 28.422457 },
+    { 14.069899, 26.491871 },
+    { 11.075043, 24.553327 },
+    { 9.642915, 21.057933 },
+    { 6.816239, 18.951732 },
+    { 3.912702, 16.922396 },
+    { 1.012373, 14.889845 },
+    { -0.588703, 11.561696 },
+    { -3.393103, 9.433461 },
+    { 15.723588, 29.380446 },
+    { 12.842191, 27.329349 },
+    { 11.166653, 24.075194 },
+    { 8.336961, 21.972596 },
+    { 5.419902, 19.957652 },
+    { 2.494453, 17.951322 },
+    { 0.797408, 14.719494 },
+    { -2.129235, 12.714866 },
+    { -5.184874, 10.840274 },
+    { 13.689795, 31.032885 },
+    { 12.246928, 27.545373 },
+    { 9.107530, 25.757072 },
+    { 5.688983, 24.254807 },
+    { 1.869086, 23.190787 },
+    { 0.577297, 19.538991 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.408597, 22.788363 },
+    { 14.183633, 22.079675 },
+    { 10.397373, 20.932440 },
+    { 9.530297, 16.862685 },
+    { 6.351151, 15.107871 },
+    { 3.094292, 13.430810 },
+    { -0.110934, 11.702151 },
+    { -1.381112, 8.037044 },
+    { 17.669974, 28.058123 },
+    { 14.637025, 26.157074 },
+    { 11.621702, 24.238408 },
+    { 9.972476, 20.952607 },
+    { 7.126568, 18.864461 },
+    { 4.202221, 16.854739 },
+    { 1.283359, 14.839528 },
+    { -0.486179, 11.674360 },
+    { -3.309042, 9.563121 },
+    { 15.791098, 29.534837 },
+    { 12.886089, 27.505685 },
+    { 11.046027, 24.411061 },
+    { 8.190860, 22.332031 },
+    { 5.237741, 20.350854 },
+    { 2.267798, 18.386418 },
+    { 0.345684, 15.373595 },
+    { -2.640474, 13.425195 },
+    { -5.799666, 11.649358 },
+    { 12.938233, 31.980947 },
+    { 11.309998, 28.674954 },
+    { 7.930207, 27.117337 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.350433, 27.678939 },
+    { 14.903161, 26.197500 },
+    { 11.273807, 24.901178 },
+    { 7.590029, 23.664766 },
+    { 7.826510, 18.461646 },
+    { 4.786299, 16.570754 },
+    { 1.626343, 14.800290 },
+    { -1.537651, 13.034566 },
+    { -2.335811, 8.888775 },
+    { 16.746071, 28.865620 },
+    { 13.759291, 26.920879 },
+    { 10.773236, 24.975611 },
+    { 9.531861, 21.277204 },
+    { 6.715799, 19.161096 },
+    { 3.822837, 17.121935 },
+    { 0.931133, 15.081551 },
+    { -0.534857, 11.610478 },
+    { -3.331553, 9.474734 },
+    { 15.793525, 29.407607 },
+    { 12.922715, 27.345892 },
+    { 11.384698, 23.947604 },
+    { 8.563983, 21.835552 },
+    { 5.660649, 19.805889 },
+    { 2.752270, 17.781101 },
+    { 1.222400, 14.374106 },
+    { -1.686777, 12.349693 },
+    { -4.709546, 10.438110 },
+    { 14.261782, 30.522173 },
+    { 12.990817, 26.857523 },
+    { 9.912266, 25.000333 },
+    { 6.640028, 23.333756 },
+    { 3.241929, 21.786840 },
+    { 2.198775, 17.891451 },
+    { -1.498428, 16.631737 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.434749, 32.094463 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.304753, 20.438104 },
+    { 2.176888, 18.637876 },
+    { -1.215051, 17.108105 },
+    { -4.936545, 15.935316 },
+    { -3.917475, 9.916400 },
+    { 15.139325, 29.927006 },
+    { 12.087009, 28.048796 },
+    { 8.993288, 26.213287 },
+    { 8.692219, 21.565841 },
+    { 5.864132, 19.461333 },
+    { 2.949041, 17.444129 },
+    { 0.026050, 15.435050 },
+    { -0.815282, 11.335968 },
+    { -3.618567, 9.206305 },
+    { 15.500604, 29.153306 },
+    { 12.620366, 27.100734 },
+    { 11.667170, 23.115660 },
+    { 8.841628, 21.007991 },
+    { 5.938981, 18.977433 },
+    { 3.039366, 16.943836 },
+    { 2.241138, 12.804167 },
+    { -0.670279, 10.782082 },
+    { -3.671086, 8.849250 },
+    { 15.350330, 28.893211 },
+    { 14.945984, 24.360542 },
+    { 11.868399, 22.504141 },
+    { 8.683766, 20.754383 },
+    { 5.513832, 18.989531 },
+    { 6.437555, 13.126817 },
+    { 2.809829, 11.819171 },
+    { -0.893569, 10.585662 },
+    { -4.542837, 9.295868 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.513353, 21.856200 },
+    { 1.138674, 20.291866 },
+    { 99.000000, 20.169839 },
+    { 99.000000, 99.000000 },
+    { -4.191945, 10.826788 },
+    { 14.836009, 30.877320 },
+    { 11.678658, 29.098369 },
+    { 8.410176, 27.429381 },
+    { 8.774601, 22.137082 },
+    { 5.919903, 20.056585 },
+    { 2.966688, 18.074485 },
+    { -0.003244, 16.108998 },
+    { -0.495437, 11.668610 },
+    { -3.317926, 9.556022 },
+    { 15.786326, 29.531118 },
+    { 12.881149, 27.501148 },
+    { 12.229153, 23.219770 },
+    { 9.383803, 21.130105 },
+    { 6.459330, 19.119547 },
+    { 3.540291, 17.103548 },
+    { 3.135725, 12.574455 },
+    { 0.188608, 10.586603 },
+    { -2.844531, 8.684784 },
+    { 16.143271, 28.776730 },
+    { 16.306122, 23.680013 },
+    { 13.130532, 21.920717 },
+    { 9.875080, 20.241335 },
+    { 6.670484, 18.511142 },
+    { 99.000000, 99.000000 },
+    { 5.437729, 9.875681 },
+    { 1.223568, 9.155299 },
+    { -2.560336, 8.004848 },
+    { 15.531939, 30.829806 },
+    { 11.889518, 29.518120 },
+    { 6.866366, 29.336073 },
+    { 99.000000, 99.000000 },
+    { 6.460053, 20.199194 },
+    { 3.386133, 18.336961 },
+    { 0.123230, 16.660712 },
+    { -3.254682, 15.093722 },
+    { -3.068588, 10.006853 },
+    { 16.042088, 29.956378 },
+    { 13.023556, 28.040174 },
+    { 9.982219, 26.146006 },
+    { 9.339988, 21.868743 },
+    { 6.520169, 19.755376 },
+    { 3.617810, 17.724312 },
+    { 0.710756, 15.697771 },
+    { -0.331933, 11.814842 },
+    { -3.127910, 9.677965 },
+    { 15.999562, 29.611783 },
+    { 13.129318, 27.549101 },
+    { 11.982601, 23.768384 },
+    { 9.167361, 21.651064 },
+    { 6.274802, 19.611114 },
+    { 3.383285, 17.570161 },
+    { 2.353166, 13.672709 },
+    { -0.540333, 11.634049 },
+    { -3.526956, 9.688773 },
+    { 15.464458, 29.759998 },
+    { 14.745057, 25.550815 },
+    { 11.707786, 23.656703 },
+    { 8.548221, 21.885639 },
+    { 5.381819, 20.122208 },
+    { 5.514106, 15.063908 },
+    { 2.075090, 13.574111 },
+    { -1.554665, 12.278424 },
+    { -5.250380, 11.055020 },
+    { 19.825959, 26.057219 },
+    { 16.152122, 24.796230 },
+    { 12.429896, 23.582290 },
+    { 8.780162, 22.294044 },
+    { 8.439992, 17.719850 },
+    { 5.357742, 15.868509 },
+    { 2.170431, 14.121854 },
+    { -1.000039, 12.358001 },
+    { -2.024783, 8.457620 },
+    { 17.075979, 28.420043 },
+    { 14.073139, 26.489587 },
+    { 11.078209, 24.551117 },
+    { 9.644674, 21.057110 },
+    { 6.817911, 18.950993 },
+    { 3.914281, 16.921748 },
+    { 1.013874, 14.889274 },
+    { -0.588268, 11.562176 },
+    { -3.392749, 9.434020 },
+    { 15.723854, 29.381116 },
+    { 12.842350, 27.330125 },
+    { 11.165773, 24.076997 },
+    { 8.335970, 21.974507 },
+    { 5.418751, 19.959722 },
+    { 2.493105, 17.953586 },
+    { 0.794701, 14.723107 },
+    { -2.132183, 12.718719 },
+    { -5.188235, 10.844541 },
+    { 13.685826, 31.037785 },
+    { 12.241698, 27.551525 },
+    { 9.101520, 25.764016 },
+    { 5.681068, 24.263720 },
+    { 1.853491, 23.208367 },
+    { 0.561638, 19.555996 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.405316, 22.794723 },
+    { 14.182307, 22.084098 },
+    { 10.396560, 20.936372 },
+    { 9.530170, 16.865892 },
+    { 6.351279, 15.110836 },
+    { 3.094605, 13.433603 },
+    { -0.110506, 11.704842 },
+    { -1.380369, 8.039407 },
+    { 17.670688, 28.060427 },
+    { 14.637822, 26.159307 },
+    { 11.622564, 24.240589 },
+    { 9.973655, 20.954464 },
+    { 7.127794, 18.866281 },
+    { 4.203497, 16.856520 },
+    { 1.284679, 14.841274 },
+    { -0.484627, 11.675873 },
+    { -3.307453, 9.564606 },
+    { 15.792690, 29.536228 },
+    { 12.887731, 27.507036 },
+    { 11.047910, 24.412169 },
+    { 8.192790, 22.333100 },
+    { 5.239736, 20.351864 },
+    { 2.269871, 18.387354 },
+    { 0.348074, 15.374208 },
+    { -2.637983, 13.425706 },
+    { -5.796988, 11.649674 },
+    { 12.941349, 31.980706 },
+    { 11.313334, 28.674498 },
+    { 7.934154, 27.116227 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.338128, 27.690610 },
+    { 14.891695, 26.208362 },
+    { 11.262338, 24.912096 },
+    { 7.577299, 23.677055 },
+    { 7.820266, 18.467286 },
+    { 4.780247, 16.576220 },
+    { 1.620347, 14.805722 },
+    { -1.543789, 13.040165 },
+    { -2.339534, 8.891941 },
+    { 16.742381, 28.868647 },
+    { 13.755652, 26.923871 },
+    { 10.769586, 24.978632 },
+    { 9.530075, 21.278362 },
+    { 6.714075, 19.162207 },
+    { 3.821171, 17.123004 },
+    { 0.929508, 15.082594 },
+    { -0.535116, 11.610163 },
+    { -3.331751, 9.474372 },
+    { 15.793336, 29.407130 },
+    { 12.922603, 27.345355 },
+    { 11.385910, 23.945752 },
+    { 8.565277, 21.833634 },
+    { 5.662063, 19.803867 },
+    { 2.753836, 17.778944 },
+    { 1.225641, 14.370287 },
+    { -1.683369, 12.345724 },
+    { -4.705841, 10.433866 },
+    { 14.265840, 30.517481 },
+    { 12.996605, 26.851111 },
+    { 9.918503, 24.993500 },
+    { 6.647240, 23.325998 },
+    { 3.251213, 21.777133 },
+    { 2.211396, 17.878405 },
+    { -1.481926, 16.615132 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.419896, 32.108891 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.299030, 20.443112 },
+    { 2.170477, 18.643585 },
+    { -1.223094, 17.115496 },
+    { -4.950159, 15.948828 },
+    { -3.920821, 9.919050 },
+    { 15.135785, 29.929822 },
+    { 12.083092, 28.051993 },
+    { 8.988798, 26.217066 },
+    { 8.690601, 21.566756 },
+    { 5.862415, 19.462350 },
+    { 2.947180, 17.445293 },
+    { 0.024013, 15.436395 },
+    { -0.815632, 11.335640 },
+    { -3.618987, 9.206052 },
+    { 15.500076, 29.153131 },
+    { 12.619745, 27.100657 },
+    { 11.668061, 23.114083 },
+    { 8.842444, 21.006494 },
+    { 5.939718, 18.976019 },
+    { 3.040038, 16.942493 },
+    { 2.243731, 12.800917 },
+    { -0.667816, 10.778969 },
+    { -3.668730, 8.846250 },
+    { 15.352567, 28.890305 },
+    { 14.950796, 24.355073 },
+    { 11.872882, 22.499009 },
+    { 8.688033, 20.749477 },
+    { 5.518049, 18.984688 },
+    { 6.449499, 13.114266 },
+    { 2.819492, 11.808919 },
+    { -0.884868, 10.576400 },
+    { -4.534109, 9.286627 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.515668, 21.854500 },
+    { 1.141631, 20.289491 },
+    { 99.000000, 20.115038 },
+    { 99.000000, 99.000000 },
+    { -4.190626, 10.826191 },
+    { 14.837464, 30.876489 },
+    { 11.680331, 29.097314 },
+    { 8.412256, 27.427901 },
+    { 8.775366, 22.137011 },
+    { 5.920719, 20.056473 },
+    { 2.967573, 18.074309 },
+    { -0.002272, 16.108742 },
+    { -0.495035, 11.668966 },
+    { -3.317484, 9.556348 },
+    { 15.786770, 29.531350 },
+    { 12.881646, 27.501336 },
+    { 12.229139, 23.220499 },
+    { 9.383839, 21.130796 },
+    { 6.459420, 19.120195 },
+    { 3.540430, 17.104157 },
+    { 3.135214, 12.575742 },
+    { 0.188189, 10.587811 },
+    { -2.844865, 8.685920 },
+    { 16.142896, 28.777816 },
+    { 16.304642, 23.682229 },
+    { 13.129325, 21.922673 },
+    { 9.874075, 20.243102 },
+    { 6.669603, 18.512800 },
+    { 99.000000, 99.000000 },
+    { 5.433187, 9.881048 },
+    { 1.221006, 9.158705 },
+    { -2.562373, 8.007751 },
+    { 15.542006, 30.817202 },
+    { 11.902424, 29.502905 },
+    { 6.931243, 29.292655 },
+    { 99.000000, 99.000000 },
+    { 6.464247, 20.192375 },
+    { 3.390707, 18.329787 },
+    { 0.128626, 16.652757 },
+    { -3.247576, 15.084158 },
+    { -3.066698, 10.002357 },
+    { 16.044067, 29.951725 },
+    { 13.025780, 28.035292 },
+    { 9.984812, 26.140774 },
+    { 9.340043, 21.866030 },
+    { 6.520292, 19.752606 },
+    { 3.618033, 17.721452 },
+    { 0.711108, 15.694795 },
+    { -0.333225, 11.813510 },
+    { -3.129150, 9.676593 },
+    { 15.998336, 29.610326 },
+    { 13.128153, 27.547592 },
+    { 11.979925, 23.768391 },
+    { 9.164735, 21.651031 },
+    { 6.272221, 19.611048 },
+    { 3.380733, 17.570077 },
+    { 2.348724, 13.674522 },
+    { -0.544700, 11.635798 },
+    { -3.531285, 9.690496 },
+    { 15.460057, 29.761726 },
+    { 14.738347, 25.554859 },
+    { 11.701222, 23.660612 },
+    { 8.541675, 21.889547 },
+    { 5.375108, 20.126303 },
+    { 5.502022, 15.073385 },
+    { 2.063671, 13.582949 },
+    { -1.566183, 12.287409 },
+    { -5.263201, 11.065419 },
+    { 19.837538, 26.044664 },
+    { 16.161122, 24.786260 },
+    { 12.437807, 23.573423 },
+    { 8.787960, 22.285320 },
+    { 8.444370, 17.714453 },
+    { 5.361783, 15.863449 },
+    { 2.174242, 14.117026 },
+    { -0.996300, 12.353250 },
+    { -2.022552, 8.454342 },
+    { 17.078057, 28.416949 },
+    { 14.075101, 26.486608 },
+    { 11.080103, 24.548204 },
+    { 9.645308, 21.055434 },
+    { 6.818467, 18.949393 },
+    { 3.914754, 16.920229 },
+    { 1.014277, 14.887823 },
+    { -0.588821, 11.561666 },
+    { -3.393374, 9.433579 },
+    { 15.723150, 29.380783 },
+    { 12.841550, 27.329885 },
+    { 11.164041, 24.077676 },
+    { 8.334139, 21.975282 },
+    { 5.416775, 19.960637 },
+    { 2.490951, 17.954676 },
+    { 0.791327, 14.725406 },
+    { -2.135774, 12.721231 },
+    { -5.192200, 10.847426 },
+    { 13.681324, 31.041246 },
+    { 12.236063, 27.556104 },
+    { 9.095181, 25.769306 },
+    { 5.673006, 24.270784 },
+    { 1.838393, 23.223367 },
+    { 0.546561, 19.570373 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.401289, 22.800328 },
+    { 14.180214, 22.087776 },
+    { 10.394968, 20.939559 },
+    { 9.529265, 16.868345 },
+    { 6.350621, 15.113046 },
+    { 3.094125, 13.435637 },
+    { -0.110878, 11.706773 },
+    { -1.380424, 8.041001 },
+    { 17.670648, 28.062001 },
+    { 14.637858, 26.160805 },
+    { 11.622657, 24.242031 },
+    { 9.974063, 20.955575 },
+    { 7.128243, 18.867351 },
+    { 4.203990, 16.857546 },
+    { 1.285212, 14.842261 },
+    { -0.483864, 11.676619 },
+    { -3.306657, 9.565320 },
+    { 15.793525, 29.536895 },
+    { 12.888609, 27.507658 },
+    { 11.049028, 24.412541 },
+    { 8.193950, 22.333427 },
+    { 5.240955, 20.352128 },
+    { 2.271164, 18.387539 },
+    { 0.349685, 15.374060 },
+    { -2.636273, 13.425452 },
+    { -5.795093, 11.649220 },
+    { 12.943706, 31.979757 },
+    { 11.315911, 28.673322 },
+    { 7.937340, 27.114399 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.325987, 27.701405 },
+    { 14.880339, 26.218388 },
+    { 11.250967, 24.922176 },
+    { 7.564709, 23.688458 },
+    { 7.813884, 18.472270 },
+    { 4.774040, 16.581033 },
+    { 1.614185, 14.810497 },
+    { -1.550094, 13.045094 },
+    { -2.343537, 8.894524 },
+    { 16.738449, 28.871183 },
+    { 13.751762, 26.926366 },
+    { 10.765677, 24.981148 },
+    { 9.527944, 21.279077 },
+    { 6.711993, 19.162871 },
+    { 3.819136, 17.123621 },
+    { 0.927504, 15.083180 },
+    { -0.535823, 11.609438 },
+    { -3.332409, 9.473598 },
+    { 15.792746, 29.406310 },
+    { 12.922076, 27.344470 },
+    { 11.386644, 23.943596 },
+    { 8.566076, 21.831411 },
+    { 5.662966, 19.801539 },
+    { 2.754873, 17.776482 },
+    { 1.228268, 14.366228 },
+    { -1.680595, 12.341518 },
+    { -4.702798, 10.429395 },
+    { 14.269293, 30.512626 },
+    { 13.001708, 26.844597 },
+    { 9.924016, 24.986585 },
+    { 6.653660, 23.318203 },
+    { 3.259570, 21.767487 },
+    { 2.222934, 17.865556 },
+    { -1.466775, 16.598934 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.405124, 32.123498 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.293370, 20.448155 },
+    { 2.164128, 18.649322 },
+    { -1.231064, 17.122907 },
+    { -4.963704, 15.962419 },
+    { -3.924146, 9.921694 },
+    { 15.132303, 29.932729 },
+    { 12.079230, 28.055272 },
+    { 8.984359, 26.220920 },
+    { 8.689014, 21.567726 },
+    { 5.860720, 19.463415 },
+    { 2.945335, 17.446497 },
+    { 0.021984, 15.437770 },
+    { -0.815996, 11.335337 },
+    { -3.619432, 9.205817 },
+    { 15.499589, 29.153043 },
+    { 12.619155, 27.100660 },
+    { 11.668970, 23.112574 },
+    { 8.843265, 21.005061 },
+    { 5.940451, 18.974664 },
+    { 3.040695, 16.941201 },
+    { 2.246286, 12.797718 },
+    { -0.665406, 10.775903 },
+    { -3.666439, 8.843293 },
+    { 15.354826, 28.887486 },
+    { 14.955616, 24.349682 },
+    { 11.877353, 22.493956 },
+    { 8.692272, 20.744648 },
+    { 5.522220, 18.979922 },
+    { 6.461362, 13.101801 },
+    { 2.829040, 11.798766 },
+    { -0.876306, 10.567237 },
+    { -4.525556, 9.277494 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.517743, 21.852657 },
+    { 1.144325, 20.286975 },
+    { 99.000000, 20.076159 },
+    { 99.000000, 99.000000 },
+    { -4.189573, 10.825403 },
+    { 14.838726, 30.875541 },
+    { 11.681798, 29.096137 },
+    { 8.414112, 27.426298 },
+    { 8.775922, 22.136787 },
+    { 5.921312, 20.056200 },
+    { 2.968225, 18.073966 },
+    { -0.001547, 16.108312 },
+    { -0.494876, 11.669126 },
+    { -3.317296, 9.556472 },
+    { 15.787033, 29.531454 },
+    { 12.881951, 27.501388 },
+    { 12.228935, 23.221073 },
+    { 9.383673, 21.131324 },
+    { 6.459296, 19.120673 },
+    { 3.540344, 17.104590 },
+    { 3.134485, 12.576828 },
+    { 0.187538, 10.588812 },
+    { -2.845444, 8.686842 },
+    { 16.142349, 28.778765 },
+    { 16.303001, 23.684280 },
+    { 13.127941, 21.924460 },
+    { 9.872879, 20.244697 },
+    { 6.668519, 18.514278 },
+    { 99.000000, 99.000000 },
+    { 5.428480, 9.886159 },
+    { 1.218237, 9.161878 },
+    { -2.564638, 8.010422 },
+    { 15.552505, 30.804498 },
+    { 11.915756, 29.487551 },
+    { 6.991276, 29.249986 },
+    { 99.000000, 99.000000 },
+    { 6.468698, 20.185609 },
+    { 3.395521, 18.322659 },
+    { 0.134252, 16.644835 },
+    { -3.240248, 15.074600 },
+    { -3.064641, 9.997952 },
+    { 16.046302, 29.947198 },
+    { 13.028250, 28.030527 },
+    { 9.987643, 26.135649 },
+    { 9.340284, 21.863477 },
+    { 6.520589, 19.749990 },
+    { 3.618422, 17.718740 },
+    { 0.711616, 15.691958 },
+    { -0.334390, 11.812341 },
+    { -3.130275, 9.675378 },
+    { 15.997289, 29.609089 },
+    { 13.127160, 27.546296 },
+    { 11.977387, 23.768636 },
+    { 9.162238, 21.651230 },
+    { 6.269760, 19.611204 },
+    { 3.378293, 17.570208 },
+    { 2.344361, 13.676575 },
+    { -0.548994, 11.637778 },
+    { -3.535547, 9.692443 },
+    { 15.455759, 29.763770 },
+    { 14.731690, 25.559257 },
+    { 11.694708, 23.664867 },
+    { 8.535174, 21.893793 },
+    { 5.368432, 20.130734 },
+    { 5.489888, 15.083276 },
+    { 2.052206, 13.592187 },
+    { -1.577755, 12.296797 },
+    { -5.276109, 11.076261 },
+    { 19.850391, 26.031805 },
+    { 16.171183, 24.776185 },
+    { 12.446684, 23.564531 },
+    { 8.796687, 22.276587 },
+    { 8.449490, 17.709240 },
+    { 5.366529, 15.858596 },
+    { 2.178729, 14.112419 },
+    { -0.991905, 12.348724 },
+    { -2.019744, 8.451366 },
+    { 17.080774, 28.414200 },
+    { 14.077683, 26.483978 },
+    { 11.082604, 24.545642 },
+    { 9.646473, 21.054180 },
+    { 6.819539, 18.948215 },
+    { 3.915728, 16.919132 },
+    { 1.015167, 14.886794 },
+    { -0.588940, 11.561624 },
+    { -3.393579, 9.433605 },
+    { 15.722915, 29.380975 },
+    { 12.841204, 27.330171 },
+    { 11.162707, 24.078929 },
+    { 8.332692, 21.976632 },
+    { 5.415168, 19.962132 },
+    { 2.489150, 17.956350 },
+    { 0.788238, 14.728348 },
+    { -2.139098, 12.724395 },
+    { -5.195923, 10.850977 },
+    { 13.677055, 31.045486 },
+    { 12.230599, 27.561518 },
+    { 9.088964, 25.775475 },
+    { 5.664956, 24.278846 },
+    { 1.822778, 23.240045 },
+    { 0.531069, 19.586232 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.397764, 22.807233 },
+    { 14.178776, 22.092597 },
+    { 10.394069, 20.943846 },
+    { 9.529110, 16.871831 },
+    { 6.350728, 15.116265 },
+    { 3.094421, 13.438665 },
+    { -0.110469, 11.709685 },
+    { -1.379675, 8.043542 },
+    { 17.671433, 28.064547 },
+    { 14.638724, 26.163268 },
+    { 11.623581, 24.244431 },
+    { 9.975326, 20.957612 },
+    { 7.129547, 18.869342 },
+    { 4.205337, 16.859487 },
+    { 1.286597, 14.844157 },
+    { -0.482232, 11.678250 },
+    { -3.304997, 9.566913 },
+    { 15.795257, 29.538457 },
+    { 12.890384, 27.509168 },
+    { 11.051060, 24.413777 },
+    { 8.196022, 22.334615 },
+    { 5.243087, 20.353245 },
+    { 2.273371, 18.388568 },
+    { 0.352231, 15.374727 },
+    { -2.633627, 13.426003 },
+    { -5.792254, 11.649553 },
+    { 12.947080, 31.979562 },
+    { 11.319521, 28.672881 },
+    { 7.941598, 27.113249 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.313486, 27.714019 },
+    { 14.868691, 26.230176 },
+    { 11.239293, 24.934041 },
+    { 7.551678, 23.701799 },
+    { 7.807705, 18.478550 },
+    { 4.768053, 16.587132 },
+    { 1.608248, 14.816559 },
+    { -1.556187, 13.051331 },
+    { -2.347094, 8.898188 },
+    { 16.734947, 28.874754 },
+    { 13.748308, 26.929898 },
+    { 10.762206, 24.984708 },
+    { 9.526429, 21.280666 },
+    { 6.710536, 19.164410 },
+    { 3.817733, 17.125112 },
+    { 0.926139, 15.084641 },
+    { -0.535759, 11.609464 },
+    { -3.332289, 9.473573 },
+    { 15.792912, 29.406202 },
+    { 12.922316, 27.344295 },
+    { 11.388272, 23.942032 },
+    { 8.567781, 21.829776 },
+    { 5.664789, 19.799793 },
+    { 2.756846, 17.774594 },
+    { 1.231992, 14.362589 },
+    { -1.676706, 12.337724 },
+    { -4.698612, 10.425312 },
+    { 14.273897, 30.508099 },
+    { 13.008129, 26.838253 },
+    { 9.930890, 24.979806 },
+    { 6.661529, 23.310466 },
+    { 3.269555, 21.757741 },
+    { 2.236425, 17.852289 },
+    { -1.449365, 16.582041 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.389951, 32.138899 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.287751, 20.453644 },
+    { 2.157789, 18.655542 },
+    { -1.239108, 17.130887 },
+    { -4.977673, 15.976947 },
+    { -3.927314, 9.924724 },
+    { 15.128943, 29.935962 },
+    { 12.075478, 28.058899 },
+    { 8.980007, 26.225152 },
+    { 8.687638, 21.568979 },
+    { 5.859238, 19.464773 },
+    { 2.943701, 17.448005 },
+    { 0.020164, 15.439464 },
+    { -0.816075, 11.335295 },
+    { -3.619589, 9.205851 },
+    { 15.499344, 29.153177 },
+    { 12.618809, 27.100894 },
+    { 11.670188, 23.111252 },
+    { 8.844400, 21.003821 },
+    { 5.941499, 18.973509 },
+    { 3.041672, 16.940118 },
+    { 2.249246, 12.794658 },
+    { -0.662589, 10.772985 },
+    { -3.663738, 8.840492 },
+    { 15.357435, 28.884795 },
+    { 14.960894, 24.344327 },
+    { 11.882280, 22.488956 },
+    { 8.696967, 20.739884 },
+    { 5.526853, 18.975227 },
+    { 6.474048, 13.089065 },
+    { 2.839308, 11.788456 },
+    { -0.867061, 10.557971 },
+    { -4.516312, 9.268265 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.501144, 21.855601 },
+    { 1.124651, 20.293267 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { -4.201194, 10.822961 },
+    { 14.826179, 30.874150 },
+    { 11.668220, 29.095868 },
+    { 8.398590, 27.428144 },
+    { 8.766833, 22.131678 },
+    { 5.912010, 20.051314 },
+    { 2.958613, 18.069409 },
+    { -0.011543, 16.104167 },
+    { -0.502095, 11.662007 },
+    { -3.324683, 9.549519 },
+    { 15.779445, 29.524789 },
+    { 12.874130, 27.494960 },
+    { 12.223630, 23.212001 },
+    { 9.378146, 21.122468 },
+    { 6.453530, 19.112050 },
+    { 3.534365, 17.096176 },
+    { 3.131674, 12.565132 },
+    { 0.184300, 10.577532 },
+    { -2.849075, 8.675941 },
+    { 16.138783, 28.767870 },
+    { 16.304880, 23.667845 },
+    { 13.128484, 21.909345 },
+    { 9.872445, 20.230535 },
+    { 6.667490, 18.500684 },
+    { 99.000000, 99.000000 },
+    { 5.445367, 9.854485 },
+    { 1.225420, 9.139857 },
+    { -2.560010, 7.990888 },
+    { 15.489369, 30.872599 },
+    { 11.836078, 29.570962 },
+    { 6.469226, 29.514363 },
+    { 99.000000, 99.000000 },
+    { 6.439687, 20.220107 },
+    { 3.364368, 18.359209 },
+    { 0.098370, 16.685925 },
+    { -3.286026, 15.125079 },
+    { -3.080266, 10.019047 },
+    { 16.029985, 29.969144 },
+    { 13.010542, 28.053811 },
+    { 9.967823, 26.160971 },
+    { 9.335122, 21.874237 },
+    { 6.515067, 19.761080 },
+    { 3.612336, 17.730359 },
+    { 0.704808, 15.704263 },
+    { -0.331730, 11.815182 },
+    { -3.127879, 9.678454 },
+    { 15.999476, 29.612541 },
+    { 13.129004, 27.550059 },
+    { 11.987946, 23.763669 },
+    { 9.172534, 21.646496 },
+    { 6.279812, 19.606682 },
+    { 3.388188, 17.565809 },
+    { 2.365134, 13.661267 },
+    { -0.528635, 11.622848 },
+    { -3.515404, 9.677684 },
+    { 15.476254, 29.748807 },
+    { 14.765515, 25.530942 },
+    { 11.727695, 23.637338 },
+    { 8.568045, 21.866308 },
+    { 5.402242, 20.102209 },
+    { 5.554724, 15.023674 },
+    { 2.113155, 13.536340 },
+    { -1.516327, 12.240203 },
+    { -5.207336, 11.011671 },
+    { 19.785320, 26.101566 },
+    { 16.120473, 24.831566 },
+    { 12.402030, 23.613793 },
+    { 8.752659, 22.325086 },
+    { 8.424622, 17.739061 },
+    { 5.343580, 15.886511 },
+    { 2.157077, 14.139041 },
+    { -1.013141, 12.374922 },
+    { -2.032561, 8.469322 },
+    { 17.068732, 28.431122 },
+    { 14.066302, 26.500259 },
+    { 11.071605, 24.561557 },
+    { 9.642524, 21.063162 },
+    { 6.816049, 18.956767 },
+    { 3.912712, 16.927236 },
+    { 1.012552, 14.894522 },
+    { -0.586221, 11.564099 },
+    { -3.390438, 9.435687 },
+    { 15.726443, 29.382416 },
+    { 12.845278, 27.331095 },
+    { 11.171986, 24.074719 },
+    { 8.342544, 21.971878 },
+    { 5.425832, 19.956594 },
+    { 2.500807, 17.949846 },
+    { 0.806697, 14.715105 },
+    { -2.119414, 12.709949 },
+    { -5.174164, 10.834467 },
+    { 13.701817, 31.025680 },
+    { 12.261675, 27.535471 },
+    { 9.123973, 25.745449 },
+    { 5.709505, 24.238968 },
+    { 1.905725, 23.156801 },
+    { 0.614345, 19.505892 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.416176, 22.784764 },
+    { 14.188937, 22.078343 },
+    { 10.402079, 20.931691 },
+    { 9.534224, 16.862815 },
+    { 6.354796, 15.108286 },
+    { 3.097729, 13.431434 },
+    { -0.107624, 11.702902 },
+    { -1.378151, 8.038192 },
+    { 17.672952, 28.059212 },
+    { 14.639912, 26.158259 },
+    { 11.624521, 24.239666 },
+    { 9.974938, 20.954260 },
+    { 7.128987, 18.866164 },
+    { 4.204593, 16.856496 },
+    { 1.285688, 14.841334 },
+    { -0.484100, 11.676446 },
+    { -3.306992, 9.565244 },
+    { 15.793076, 29.536995 },
+    { 12.888022, 27.507898 },
+    { 11.047692, 24.413571 },
+    { 8.192489, 22.334589 },
+    { 5.239312, 20.353485 },
+    { 2.269296, 18.389139 },
+    { 0.346841, 15.376695 },
+    { -2.639407, 13.428408 },
+    { -5.798779, 11.652793 },
+    { 12.938494, 31.985032 },
+    { 11.310018, 28.679296 },
+    { 7.929578, 27.122438 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.378122, 27.658285 },
+    { 14.929110, 26.178551 },
+    { 11.299722, 24.882176 },
+    { 7.618398, 23.643090 },
+    { 7.842034, 18.453289 },
+    { 4.801432, 16.562786 },
+    { 1.641367, 14.792420 },
+    { -1.522344, 13.026391 },
+    { -2.325279, 8.885486 },
+    { 16.756440, 28.862409 },
+    { 13.769568, 26.917761 },
+    { 10.783545, 24.972459 },
+    { 9.538467, 21.277817 },
+    { 6.722293, 19.161828 },
+    { 3.829233, 17.122772 },
+    { 0.937463, 15.082458 },
+    { -0.531225, 11.614121 },
+    { -3.328028, 9.478492 },
+    { 15.796884, 29.411448 },
+    { 12.925943, 27.349873 },
+    { 11.385298, 23.954241 },
+    { 8.564439, 21.842342 },
+    { 5.660889, 19.812903 },
+    { 2.752232, 17.788399 },
+    { 1.219054, 14.384738 },
+    { -1.690437, 12.360646 },
+    { -4.713766, 10.449626 },
+    { 14.256643, 30.534514 },
+    { 12.982249, 26.873319 },
+    { 9.902820, 25.016998 },
+    { 6.628660, 23.352301 },
+    { 3.226424, 21.809355 },
+    { 2.176683, 17.920615 },
+    { -1.528357, 16.668198 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.472533, 32.053593 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.318294, 20.422681 },
+    { 2.192240, 18.620626 },
+    { -1.195402, 17.086413 },
+    { -4.902495, 15.897683 },
+    { -3.910238, 9.907467 },
+    { 15.146974, 29.917373 },
+    { 12.095674, 28.038165 },
+    { 9.003494, 26.201117 },
+    { 8.694761, 21.561433 },
+    { 5.866949, 19.456683 },
+    { 2.952260, 17.439108 },
+    { 0.029760, 15.429568 },
+    { -0.816049, 11.335009 },
+    { -3.619130, 9.205176 },
+    { 15.500149, 29.151782 },
+    { 12.620188, 27.098967 },
+    { 11.662953, 23.117965 },
+    { 8.837634, 21.010107 },
+    { 5.935228, 18.979340 },
+    { 3.035817, 16.945572 },
+    { 2.232483, 12.811040 },
+    { -0.678560, 10.788614 },
+    { -3.679047, 8.855491 },
+    { 15.342436, 28.899094 },
+    { 14.931206, 24.373340 },
+    { 11.854532, 22.516056 },
+    { 8.670519, 20.765700 },
+    { 5.500763, 19.000689 },
+    { 6.403985, 13.158499 },
+    { 2.782312, 11.844812 },
+    { -0.918485, 10.608693 },
+    { -4.567777, 9.318873 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 4.503478, 21.853795 },
+    { 1.127656, 20.290758 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { -4.199899, 10.822281 },
+    { 14.827624, 30.873254 },
+    { 11.669890, 29.094739 },
+    { 8.400681, 27.426573 },
+    { 8.767561, 22.131554 },
+    { 5.912787, 20.051146 },
+    { 2.959462, 18.069173 },
+    { -0.010606, 16.103845 },
+    { -0.501751, 11.662314 },
+    { -3.324299, 9.549794 },
+    { 15.779846, 29.524984 },
+    { 12.874584, 27.495108 },
+    { 12.223555, 23.212702 },
+    { 9.378119, 21.123128 },
+    { 6.453557, 19.112664 },
+    { 3.534440, 17.096748 },
+    { 3.131075, 12.566402 },
+    { 0.183792, 10.578719 },
+    { -2.849497, 8.677052 },
+    { 16.138340, 28.768942 },
+    { 16.303295, 23.670079 },
+    { 13.127176, 21.911309 },
+    { 9.871342, 20.232305 },
+    { 6.666512, 18.502339 },
+    { 99.000000, 99.000000 },
+    { 5.440564, 9.860002 },
+    { 1.222685, 9.143320 },
+    { -2.562204, 7.993828 },
+    { 15.499543, 30.859828 },
+    { 11.849234, 29.555442 },
+    { 6.624013, 29.461497 },
+    { 99.000000, 99.000000 },
+    { 6.443884, 20.213217 },
+    { 3.368952, 18.351951 },
+    { 0.103797, 16.677863 },
+    { -3.278831, 15.115347 },
+    { -3.078400, 10.014495 },
+    { 16.031961, 29.964442 },
+    { 13.012765, 28.048873 },
+    { 9.970421, 26.155673 },
+    { 9.335150, 21.871488 },
+    { 6.515163, 19.758271 },
+    { 3.612533, 17.727457 },
+    { 0.705134, 15.701240 },
+    { -0.333063, 11.813816 },
+    { -3.129163, 9.677045 },
+    { 15.998223, 29.611062 },
+    { 13.127813, 27.548525 },
+    { 11.985230, 23.763662 },
+    { 9.169867, 21.646446 },
+    { 6.277189, 19.606595 },
+    { 3.385594, 17.565699 },
+    { 2.360634, 13.663068 },
+    { -0.533058, 11.624580 },
+    { -3.519787, 9.679385 },
+    { 15.471812, 29.750533 },
+    { 14.758736, 25.535006 },
+    { 11.721068, 23.641260 },
+    { 8.561442, 21.870218 },
+    { 5.395480, 20.106296 },
+    { 5.542503, 15.033226 },
+    { 2.101637, 13.545212 },
+    { -1.527909, 12.249184 },
+    { -5.220168, 11.022007 },
+    { 19.797027, 26.089097 },
+    { 16.129646, 24.821630 },
+    { 12.410127, 23.604940 },
+    { 8.760654, 22.316357 },
+    { 8.429136, 17.733726 },
+    { 5.347753, 15.881512 },
+    { 2.161016, 14.134271 },
+    { -1.009276, 12.370225 },
+    { -2.030224, 8.466119 },
+    { 17.070948, 28.428114 },
+    { 14.068397, 26.497364 },
+    { 11.073630, 24.558726 },
+    { 9.643270, 21.061586 },
+    { 6.816713, 18.955264 },
+    { 3.913289, 16.925812 },
+    { 1.013055, 14.893164 },
+    { -0.586685, 11.563691 },
+    { -3.390976, 9.435345 },
+    { 15.725847, 29.382206 },
+    { 12.844582, 27.330976 },
+    { 11.170345, 24.075528 },
+    { 8.340801, 21.972781 },
+    { 5.423942, 19.957636 },
+    { 2.498737, 17.951060 },
+    { 0.803395, 14.717536 },
+    { -2.122934, 12.712591 },
+    { -5.178056, 10.837477 },
+    { 13.697396, 31.029304 },
+    { 12.256106, 27.540226 },
+    { 9.117705, 25.750908 },
+    { 5.701541, 24.246177 },
+    { 1.891124, 23.171479 },
+    { 0.599500, 19.520280 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.412164, 22.791049 },
+    { 14.186997, 22.082558 },
+    { 10.400672, 20.935379 },
+    { 9.533547, 16.865720 },
+    { 6.354378, 15.110930 },
+    { 3.097498, 13.433889 },
+    { -0.107744, 11.705244 },
+    { -1.377935, 8.040173 },
+    { 17.673203, 28.061191 },
+    { 14.640241, 26.160156 },
+    { 11.624908, 24.241501 },
+    { 9.975659, 20.955740 },
+    { 7.129748, 18.867598 },
+    { 4.205398, 16.857882 },
+    { 1.286532, 14.842676 },
+    { -0.483012, 11.677529 },
+    { -3.305872, 9.566290 },
+    { 15.794257, 29.538010 },
+    { 12.889247, 27.508863 },
+    { 11.049170, 24.414266 },
+    { 8.194007, 22.335236 },
+    { 5.240891, 20.354062 },
+    { 2.270952, 18.389630 },
+    { 0.348833, 15.376829 },
+    { -2.637313, 13.428428 },
+    { -5.796491, 11.652597 },
+    { 12.941294, 31.984325 },
+    { 11.313050, 28.678346 },
+    { 7.933257, 27.120788 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 18.365611, 27.670337 },
+    { 14.917476, 26.189744 },
+    { 11.288110, 24.893391 },
+    { 7.605544, 23.655655 },
+    { 7.835708, 18.459095 },
+    { 4.795299, 16.568401 },
+    { 1.635291, 14.797985 },
+    { -1.528564, 13.032111 },
+    { -2.329066, 8.888721 },
+    { 16.752731, 28.865601 },
+    { 13.765906, 26.920906 },
+    { 10.779867, 24.975621 },
+    { 9.536676, 21.279063 },
+    { 6.720556, 19.163018 },
+    { 3.827547, 17.123909 },
+    { 0.935811, 15.083560 },
+    { -0.531500, 11.613829 },
+    { -3.328251, 9.478145 },
+    { 15.796740, 29.411056 },
+    { 12.925867, 27.349409 },
+    { 11.386562, 23.952424 },
+    { 8.565774, 21.840451 },
+    { 5.662334, 19.810898 },
+    { 2.753821, 17.786250 },
+    { 1.222332, 14.380889 },
+    { -1.687002, 12.356639 },
+    { -4.710043, 10.445332 },
+    { 14.260824, 30.529800 },
+    { 12.988180, 26.866843 },
+    { 9.909194, 25.010086 },
+    { 6.636017, 23.344429 },
+    { 3.235899, 21.799455 },
+    { 2.189521, 17.907324 },
+    { -1.511509, 16.651183 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 13.457595, 32.069473 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 99.000000, 99.000000 },
+    { 5.312838, 20.428618 },
+    { 2.186063, 18.627288 },
+    { -1.203266, 17.094816 },
+    { -4.915972, 15.912279 },
+    { -3.913218, 9.910852 },
+    { 15.143836, 29.921042 },
+    { 12.092135, 28.042225 },
+    { 8.999348, 26.205781 },
+    { 8.693636, 21.563040 },
+    { 5.865710, 19.458389 },
+    { 2.950862, 17.440959 },
+    { 0.028168, 15.431600 },
+    { -0.815873, 11.335255 },
+    { -3.619039, 9.205492 },
+    { 15.500203, 29.152260 },
+    { 12.620132, 27.099540 },
+    { 11.664492, 23.116929 },
+    { 8.839080, 21.009149 },
+    { 5.936579, 18.978464 },
+    { 3.037087, 16.944762 },
+    { 2.235771, 12.808199 },
+    { -0.675425, 10.785912 },
+    { -3.676038, 8.852902 },
+    { 15.345421, 28.896656 },
+    { 14.936908, 24.368172 },
+    { 11.859868, 22.511241 },
+    { 8.675612, 20.761118 },
+    { 5.505787, 18.996167 },
+    { 6.417077, 13.145900 },
+    { 2.793023, 11.834590 },
+    { -0.908790, 10.599490 },
+    { -4.558064, 9.309672 },
+};
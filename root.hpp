@@ -0,0 +1,63 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+
+#pragma once
+
+/*
+** Root of f between lo and hi, where it changes sign (flo = f(lo), fhi = f(hi)), to within tolerance:
+** the Illinois variant of regula falsi. It stays bracketed and, for the smooth functions of the sun's
+** motion, converges superlinearly. Used by SunTrack, SunExposure and SunHorizon.
+*/
+template <typename F>
+inline double illinoisRoot (F f, double lo, double flo, double hi, double fhi, const double tolerance,
+                            const int maxIterations = 60)
+{
+    double x = lo;
+    int side = 0;
+    for (int iteration = 0; iteration < maxIterations && hi - lo > tolerance; iteration++)
+    {
+        x = (lo * fhi - hi * flo) / (fhi - flo);
+        double fx = f (x);
+        if ((fx < 0.0) == (flo < 0.0))
+        {
+            lo = x;
+            flo = fx;
+            if (side == -1) fhi /= 2.0;
+            side = -1;
+        }
+        else
+        {
+            hi = x;
+            fhi = fx;
+            if (side == 1) flo /= 2.0;
+            side = 1;
+        }
+    }
+    return x;
+}
@@ -0,0 +1,461 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <math.h>
+#include <ctype.h>
+#include <string.h>
+
+#include "rules.hpp"
+#include "sun.hpp"
+#include "fleet.hpp"
+#include "formatter.hpp"
+
+static const char *cDayNames[7] = { "sunday", "monday", "tuesday", "wednesday", "thursday", "friday", "saturday" };
+
+/*
+** Recursive descent over the rule text. Each function returns false at the first character it can't accept,
+** leaving pos there for the error position.
+*/
+struct RuleParser
+{
+    const char *text;
+    size_t      pos;
+
+    void skipBlanks ()
+    {
+        while (text[pos] == ' ' || text[pos] == '\t' || text[pos] == ',') pos++;
+    }
+
+    // Length of the word at pos (letters only)
+    size_t wordLength ()
+    {
+        size_t n = 0;
+        while (isalpha ((unsigned char) text[pos + n])) n++;
+        return n;
+    }
+
+    // Accept the next word when it is one of the given, null terminated list; returns its index or -1
+    int word (const char *const *words)
+    {
+        skipBlanks ();
+        size_t n = wordLength ();
+        if (n == 0) return -1;
+        for (int i = 0; words[i] != nullptr; i++)
+            if (strlen (words[i]) == n && !strncasecmp (text + pos, words[i], n))
+            {
+                pos += n;
+                return i;
+            }
+        return -1;
+    }
+
+    bool keyword (const char *w)
+    {
+        const char *words[] = { w, nullptr };
+        return word (words) == 0;
+    }
+
+    // A day name, or a prefix of one of at least three letters; returns 0 (Sunday) to 6 or -1
+    int dayName ()
+    {
+        skipBlanks ();
+        size_t n = wordLength ();
+        if (n < 3) return -1;
+        for (int d = 0; d < 7; d++)
+            if (n <= strlen (cDayNames[d]) && !strncasecmp (text + pos, cDayNames[d], n))
+            {
+                pos += n;
+                return d;
+            }
+        return -1;
+    }
+
+    bool number (double *value)
+    {
+        char *end;
+        if (!isdigit ((unsigned char) text[pos])) return false;
+        *value = strtod (text + pos, &end);
+        pos = end - text;
+        return true;
+    }
+
+    // HH:MM, 0:00 to 24:00
+    bool timeOfDay (long *seconds)
+    {
+        skipBlanks ();
+        size_t start = pos;
+        long hh = 0, mm = 0;
+        if (!isdigit ((unsigned char) text[pos])) return false;
+        while (isdigit ((unsigned char) text[pos])) hh = hh * 10 + (text[pos++] - '0');
+        if (text[pos] != ':' || !isdigit ((unsigned char) text[pos + 1]) || !isdigit ((unsigned char) text[pos + 2])
+            || isdigit ((unsigned char) text[pos + 3]))
+        {
+            pos = start;
+            return false;
+        }
+        mm = (text[pos + 1] - '0') * 10 + (text[pos + 2] - '0');
+        if (hh > 24 || mm > 59 || (hh == 24 && mm > 0))
+        {
+            pos = start;
+            return false;
+        }
+        pos += 3;
+        *seconds = hh * 3600 + mm * 60;
+        return true;
+    }
+
+    // +1h, - 30 min, -1h15m (also the Unicode minus sign); no sign means no offset
+    bool offset (long *seconds)
+    {
+        static const char *const hours[]   = { "h", "hr", "hrs", "hour", "hours", nullptr };
+        static const char *const minutes[] = { "m", "min", "mins", "minute", "minutes", nullptr };
+        static const char *const secs[]    = { "s", "sec", "secs", "second", "seconds", nullptr };
+
+        *seconds = 0;
+        while (text[pos] == ' ' || text[pos] == '\t') pos++;
+        int sign;
+        if (text[pos] == '+') { sign = 1; pos++; }
+        else if (text[pos] == '-') { sign = -1; pos++; }
+        else if (!strncmp (text + pos, "\xE2\x88\x92", 3)) { sign = -1; pos += 3; }
+        else return true;
+
+        double total = 0.0;
+        bool any = false;
+        for (;;)
+        {
+            while (text[pos] == ' ' || text[pos] == '\t') pos++;
+            double value;
+            size_t start = pos;
+            if (!number (&value)) break;
+            while (text[pos] == ' ' || text[pos] == '\t') pos++;
+            if (word (hours) >= 0) total += value * 3600.0;
+            else if (word (minutes) >= 0) total += value * 60.0;
+            else if (word (secs) >= 0) total += value;
+            else
+            {
+                pos = start;
+                return false;
+            }
+            any = true;
+        }
+        *seconds = sign * (long) floor (total + 0.5);
+        return any;
+    }
+
+    bool term (SunRuleTerm *t)
+    {
+        static const char *const twilights[] = { "daylight", "civil", "nautical", "astronomical", nullptr };
+        static const double angles[] = { TWILIGHT_ANGLE_DAYLIGHT, TWILIGHT_ANGLE_CIVIL, TWILIGHT_ANGLE_NAUTICAL,
+                                         TWILIGHT_ANGLE_ASTRONOMICAL };
+        static const char *const events[] = { "sunrise", "rise", "dawn", "sunset", "set", "dusk", "noon", nullptr };
+
+        if (timeOfDay (&t->seconds))
+        {
+            t->event = SUN_RULE_TIME;
+            return true;
+        }
+
+        int twilight = word (twilights);
+        int event = word (events);
+        if (event < 0) return false;
+
+        t->event = event <= 2 ? SUN_RULE_RISE : event <= 5 ? SUN_RULE_SET : SUN_RULE_NOON;
+        bool twilightEvent = event == 2 || event == 5;
+        t->twilightAngle = twilight >= 0 ? angles[twilight] : twilightEvent ? TWILIGHT_ANGLE_CIVIL : TWILIGHT_ANGLE_DAYLIGHT;
+        return offset (&t->seconds);
+    }
+
+    // After "on": weekdays, weekends, every day, day names and ranges
+    bool days (unsigned char *mask)
+    {
+        static const char *const groups[] = { "weekdays", "weekends", "daily", "everyday", "every", nullptr };
+        *mask = 0;
+        bool any = false;
+        for (;;)
+        {
+            size_t start = pos;
+            keyword ("and");
+            int group = word (groups);
+            if (group == 0) *mask |= 0x3E;
+            else if (group == 1) *mask |= 0x41;
+            else if (group == 2 || group == 3) *mask |= SUN_RULE_EVERY_DAY;
+            else if (group == 4)
+            {
+                if (!keyword ("day")) return false;
+                *mask |= SUN_RULE_EVERY_DAY;
+            }
+            else
+            {
+                int first = dayName ();
+                if (first < 0)
+                {
+                    pos = start;
+                    if (!any) skipBlanks ();
+                    return any;
+                }
+                int last = first;
+                while (text[pos] == ' ') pos++;
+                if (text[pos] == '-')
+                {
+                    pos++;
+                    if ((last = dayName ()) < 0) return false;
+                }
+                for (int d = first; ; d = (d + 1) % 7)
+                {
+                    *mask |= 1 << d;
+                    if (d == last) break;
+                }
+            }
+            any = true;
+        }
+    }
+};
+
+bool compileSunRule (const char *text, SunRule *rule, size_t *errorPosition)
+{
+    static const char *const orders[] = { "earlier", "earliest", "first", "later", "latest", "last", nullptr };
+    static const char *const ignored[] = { "but", "and", "is", nullptr };
+
+    RuleParser parser = { text, 0 };
+    SunRule result;
+    bool ok = true;
+
+    do
+    {
+        if (result.termCount == SUN_RULE_MAX_TERMS || !parser.term (&result.terms[result.termCount]))
+        {
+            ok = false;
+            break;
+        }
+        result.termCount++;
+    }
+    while (parser.keyword ("or"));
+
+    while (ok)
+    {
+        parser.skipBlanks ();
+        if (text[parser.pos] == '\0') break;
+
+        if (parser.word (ignored) >= 0) continue;
+        if (parser.keyword ("whichever"))
+        {
+            parser.keyword ("is");
+            int order = parser.word (orders);
+            if (order < 0) ok = false;
+            result.later = order >= 3;
+        }
+        else if (parser.keyword ("on")) ok = parser.days (&result.weekdays);
+        else if (parser.keyword ("not"))
+        {
+            bool before = parser.keyword ("before");
+            if (!before && !parser.keyword ("after")) ok = false;
+            else ok = parser.timeOfDay (before ? &result.notBefore : &result.notAfter);
+        }
+        else if (parser.keyword ("local")) result.utc = false;
+        else if (parser.keyword ("utc") || parser.keyword ("gmt")) result.utc = true;
+        else ok = false;
+    }
+
+    if (ok && result.notBefore != SUN_RULE_NO_LIMIT && result.notAfter != SUN_RULE_NO_LIMIT
+        && result.notBefore > result.notAfter) ok = false;
+
+    if (!ok)
+    {
+        if (errorPosition != nullptr) *errorPosition = parser.pos;
+        return false;
+    }
+    *rule = result;
+    return true;
+}
+
+SunRuleSet::SunRuleSet (const UtcOffsetTable *z, const ChebyshevEphemeris *eph) : zone{z}, ephemeris{eph}
+{
+}
+
+uint32_t SunRuleSet::siteIndex (const double latitude, const double longitude, const double angle)
+{
+    std::pair<std::pair<double, double>, double> key (std::make_pair (latitude, longitude), angle);
+    std::map<std::pair<std::pair<double, double>, double>, uint32_t>::iterator found = siteLookup.find (key);
+    if (found != siteLookup.end ()) return found->second;
+
+    uint32_t index = (uint32_t) sites.size ();
+    sites.push_back (SunSite (latitude, longitude, angle));
+    siteLookup[key] = index;
+    return index;
+}
+
+size_t SunRuleSet::add (const double latitude, const double longitude, const SunRule &rule)
+{
+    Compiled c;
+    c.rule = rule;
+    for (int i = 0; i < SUN_RULE_MAX_TERMS; i++)
+    {
+        const SunRuleTerm &term = rule.terms[i];
+        // Noon does not depend on the twilight angle: share the arcs of plain sun rise and set
+        double angle = term.event == SUN_RULE_NOON ? TWILIGHT_ANGLE_DAYLIGHT : term.twilightAngle;
+        c.site[i] = i < rule.termCount && term.event != SUN_RULE_TIME ? siteIndex (latitude, longitude, angle) : 0;
+    }
+    rules.push_back (c);
+    return rules.size () - 1;
+}
+
+bool SunRuleSet::add (const double latitude, const double longitude, const char *text, size_t *index)
+{
+    SunRule rule;
+    size_t errorPosition;
+    if (!compileSunRule (text, &rule, &errorPosition))
+    {
+        printf ("Error: Couldn't compile the rule at \"%s\"\n", text + errorPosition);
+        return false;
+    }
+    size_t added = add (latitude, longitude, rule);
+    if (index != nullptr) *index = added;
+    return true;
+}
+
+/*
+** Days are counted from 1970-01-01 here; the prepared range keeps a margin of two days before from, as the
+** sun events of a local day may come from the neighbouring UTC days.
+*/
+void SunRuleSet::prepare (const time_t from, const int days)
+{
+    firstDay = (long) floor ((double) from / 86400.0) - 2;
+    dayCount = days + 3;
+    preparedSites = sites.size ();
+    arcs.assign ((size_t) dayCount * sites.size (), SunArc (0.0, 0.0));
+    if (sites.empty ()) return;
+
+    SunFleet fleet (sites, 0.25, 1.0, ephemeris);
+    for (long d = 0; d < dayCount; d++)
+        fleet.riset ((unsigned long) (firstDay + d - (DAYS_TO_2000)), &arcs[(size_t) d * sites.size ()]);
+}
+
+SunArc SunRuleSet::arc (const uint32_t site, const long day) const
+{
+    long d = day - firstDay;
+    if (d >= 0 && d < dayCount && site < preparedSites) return arcs[(size_t) d * preparedSites + site];
+
+    const SunSite &s = sites[site];
+    Sun sun (s.longitude, s.latitude, s.twilightAngle);
+    sun.ephemeris = ephemeris;
+    return sun.riset ((unsigned long) (day - (DAYS_TO_2000)));
+}
+
+/*
+** A local time (seconds since the epoch as if local were UTC) to UTC, with the offset in effect at that moment
+*/
+time_t SunRuleSet::toUtc (const time_t local, const bool utc) const
+{
+    if (utc || zone == nullptr) return local;
+    return local - zone->offset (local - zone->offset (local));
+}
+
+/*
+** The fire of a rule on a local day, if any. Each sun event is taken from the UTC day (the day itself or a
+** neighbour) whose event falls on the local day.
+*/
+bool SunRuleSet::fireOnDay (const Compiled &c, const long localDay, time_t *fire) const
+{
+    const SunRule &rule = c.rule;
+    int weekday = (int) (((localDay + 4) % 7 + 7) % 7);   // 1970-01-01 was a Thursday
+    if (!(rule.weekdays & (1 << weekday))) return false;
+
+    const time_t localMidnight = (time_t) localDay * 86400;
+    const time_t dayStart = toUtc (localMidnight, rule.utc);
+    const time_t dayEnd = toUtc (localMidnight + 86400, rule.utc);
+
+    bool found = false;
+    time_t best = 0;
+    for (int i = 0; i < rule.termCount; i++)
+    {
+        const SunRuleTerm &term = rule.terms[i];
+        time_t t;
+        bool exists = false;
+        if (term.event == SUN_RULE_TIME)
+        {
+            t = toUtc (localMidnight + term.seconds, rule.utc);
+            exists = true;
+        }
+        else
+        {
+            for (long day = localDay - 1; day <= localDay + 1 && !exists; day++)
+            {
+                SunArc a = arc (c.site[i], day);
+                double hour;
+                if (term.event == SUN_RULE_NOON) hour = a.southHourUTC;
+                else
+                {
+                    if (a.diurnalArc <= 0.0 || a.diurnalArc >= 24.0) continue;
+                    hour = term.event == SUN_RULE_RISE ? a.southHourUTC - a.diurnalArc / 2.0
+                                                       : a.southHourUTC + a.diurnalArc / 2.0;
+                }
+                time_t event = (time_t) floor ((double) day * 86400.0 + hour * 3600.0);
+                if (event < dayStart || event >= dayEnd) continue;
+                t = event + term.seconds;
+                exists = true;
+            }
+        }
+        if (!exists) continue;
+        if (!found || (rule.later ? t > best : t < best)) best = t;
+        found = true;
+    }
+    if (!found) return false;
+
+    if (rule.notBefore != SUN_RULE_NO_LIMIT)
+    {
+        time_t limit = toUtc (localMidnight + rule.notBefore, rule.utc);
+        if (best < limit) best = limit;
+    }
+    if (rule.notAfter != SUN_RULE_NO_LIMIT)
+    {
+        time_t limit = toUtc (localMidnight + rule.notAfter, rule.utc);
+        if (best > limit) best = limit;
+    }
+    *fire = best;
+    return true;
+}
+
+time_t SunRuleSet::nextFire (const size_t rule, const time_t after) const
+{
+    const Compiled &c = rules[rule];
+    long offset = c.rule.utc || zone == nullptr ? 0 : zone->offset (after);
+    long localDay = (long) floor ((double) (after + offset) / 86400.0);
+
+    // Offsets can move a fire into the neighbouring day: start one day early
+    for (long day = localDay - 1; day <= localDay + 370; day++)
+    {
+        time_t fire;
+        if (fireOnDay (c, day, &fire) && fire > after) return fire;
+    }
+    return SUN_RULE_NO_FIRE;
+}
+
+void SunRuleSet::nextFires (const time_t after, time_t *fires) const
+{
+    for (size_t i = 0; i < rules.size (); i++) fires[i] = nextFire (i, after);
+}
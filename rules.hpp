@@ -0,0 +1,230 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include <map>
+#include <vector>
+
+#include "libsunwait.hpp"
+#include "sunarc.hpp"
+
+class ChebyshevEphemeris;
+class UtcOffsetTable;
+
+/**
+ * @defgroup SunRules Definitions for schedule rules
+ *
+ * @brief Limits and markers of SunRule and SunRuleSet
+ */
+/**
+ * @addtogroup SunRules
+ * @{
+ */
+/// Most times a rule can choose from
+#define SUN_RULE_MAX_TERMS 4
+/// No time of day limit (SunRule::notBefore, SunRule::notAfter)
+#define SUN_RULE_NO_LIMIT -1
+/// A rule which does not fire within a year
+#define SUN_RULE_NO_FIRE INT64_MAX
+/// Every day of the week (SunRule::weekdays)
+#define SUN_RULE_EVERY_DAY 0x7F
+/**@}*/
+
+/**
+ * @brief What a term of a rule refers to
+ */
+typedef enum
+{
+    /// A fixed time of day
+    SUN_RULE_TIME
+    /// Sun rise (or dawn) for the term's twilight angle
+    , SUN_RULE_RISE
+    /// Sun set (or dusk) for the term's twilight angle
+    , SUN_RULE_SET
+    /// The sun in the south (solar noon)
+    , SUN_RULE_NOON
+} SunRuleEvent;
+
+/**
+ * @brief One candidate time of a rule: a sun event or a time of day, plus an offset
+ */
+struct SunRuleTerm
+{
+    /// Kind of term
+    SunRuleEvent event = SUN_RULE_TIME;
+    /// Twilight angle of a sun event, degrees
+    double       twilightAngle = TWILIGHT_ANGLE_DAYLIGHT;
+    /// Seconds added to the sun event; for SUN_RULE_TIME the seconds after midnight
+    long         seconds = 0;
+};
+
+/**
+ * @brief A compiled schedule rule, see compileSunRule
+ *
+ * The rule fires once on each selected day: at the earliest (or latest) of its terms which exist on that day,
+ * moved into the window [notBefore, notAfter]. Days and times of day are those of the local timezone, or of UTC.
+ */
+struct SunRule
+{
+    /// Candidate times
+    SunRuleTerm   terms[SUN_RULE_MAX_TERMS];
+    /// Number of terms
+    unsigned char termCount = 0;
+    /// Fire at the latest term instead of the earliest
+    bool          later = false;
+    /// Bit d set: the rule fires on day d of the week (0 = Sunday)
+    unsigned char weekdays = SUN_RULE_EVERY_DAY;
+    /// Earliest time of day in seconds after midnight, or SUN_RULE_NO_LIMIT
+    long          notBefore = SUN_RULE_NO_LIMIT;
+    /// Latest time of day in seconds after midnight, or SUN_RULE_NO_LIMIT
+    long          notAfter = SUN_RULE_NO_LIMIT;
+    /// Days and times of day are UTC instead of local
+    bool          utc = false;
+};
+
+/**
+ * @brief Compile a rule from text
+ *
+ * A rule is one or more terms joined by <tt>or</tt>, followed by optional clauses in any order, e.g.
+ * <tt>sunset-30min on weekdays, not before 17:00 local</tt> or <tt>civil dawn or 06:30, whichever is later</tt>.
+ *
+ * - Terms: <tt>HH:MM</tt>, or a sun event <tt>sunrise</tt>, <tt>sunset</tt>, <tt>dawn</tt>, <tt>dusk</tt>
+ *   or <tt>noon</tt>, optionally preceded by <tt>daylight</tt>, <tt>civil</tt>, <tt>nautical</tt> or
+ *   <tt>astronomical</tt> and followed by an offset such as <tt>+1h</tt>, <tt>- 30 min</tt> or <tt>-1h15m</tt>.
+ *   Dawn and dusk are civil unless another twilight is given.
+ * - <tt>whichever is earlier</tt> (the default) or <tt>whichever is later</tt>.
+ * - <tt>on</tt> followed by <tt>weekdays</tt>, <tt>weekends</tt>, <tt>every day</tt>, day names
+ *   (<tt>mon</tt> or <tt>monday</tt>) and ranges (<tt>mon-fri</tt>).
+ * - <tt>not before HH:MM</tt> and <tt>not after HH:MM</tt>.
+ * - <tt>local</tt> (the default) or <tt>utc</tt>.
+ *
+ * Words are case insensitive; commas and the words <tt>but</tt>, <tt>and</tt> and <tt>is</tt> are ignored.
+ *
+ * @param text Rule, null terminated
+ * @param rule Output
+ * @param errorPosition When not successful, the offset of the first character which could not be accepted (optional)
+ * @return Return true when the whole text was a valid rule.
+ */
+bool compileSunRule (const char *text, SunRule *rule, size_t *errorPosition = nullptr);
+
+/**
+ * @brief Many rules at many sites, with the next fire computed from cached sun arcs
+ *
+ * Sites with the same twilight angle share their arcs. prepare() computes the arcs of all of them for a range
+ * of days in one pass (per latitude band, see SunFleet); nextFire() then only needs array lookups and calendar
+ * arithmetic. Days outside the prepared range are computed on demand.
+ */
+class SunRuleSet
+{
+    public:
+    /**
+     * @brief Construct an empty rule set
+     *
+     * @param zone Local timezone (not owned; it has to cover the times asked for). By default local is UTC.
+     * @param ephemeris Optional precomputed ephemeris, see SunWait::ephemeris
+     */
+        SunRuleSet (const UtcOffsetTable *zone = nullptr, const ChebyshevEphemeris *ephemeris = nullptr);
+
+    /**
+     * @brief Add a rule
+     *
+     * @param latitude Geographical latitude in decimal degrees
+     * @param longitude Geographical longitude in decimal degrees
+     * @param rule Compiled rule
+     * @return Index of the rule
+     */
+        size_t add (const double latitude, const double longitude, const SunRule &rule);
+
+    /**
+     * @brief Compile and add a rule
+     *
+     * @param latitude Geographical latitude in decimal degrees
+     * @param longitude Geographical longitude in decimal degrees
+     * @param text Rule, see compileSunRule
+     * @param index Index of the rule (optional)
+     * @return Return true when the rule could be compiled.
+     */
+        bool add (const double latitude, const double longitude, const char *text, size_t *index = nullptr);
+
+    /**
+     * @brief Compute and keep the sun arcs of all rules for a range of days
+     *
+     * @param from First time of interest
+     * @param days Number of days
+     */
+        void prepare (const time_t from, const int days = 9);
+
+    /**
+     * @brief Next time a rule fires
+     *
+     * @param rule Index of the rule
+     * @param after Time to search from; the fire is strictly later
+     * @return Time of the fire, or SUN_RULE_NO_FIRE
+     */
+        time_t nextFire (const size_t rule, const time_t after) const;
+
+    /**
+     * @brief Next time of all rules
+     *
+     * @param after Time to search from
+     * @param fires Output, one time per rule (SUN_RULE_NO_FIRE when it does not fire within a year)
+     */
+        void nextFires (const time_t after, time_t *fires) const;
+
+    /// Number of rules
+        size_t size () const { return rules.size (); }
+
+    /// Number of distinct sites and twilight angles, whose arcs are computed
+        size_t arcSites () const { return sites.size (); }
+
+    private:
+        struct Compiled
+        {
+            SunRule  rule;
+            uint32_t site[SUN_RULE_MAX_TERMS];   // index into sites, per term
+        };
+
+        uint32_t siteIndex (const double latitude, const double longitude, const double angle);
+        SunArc arc (const uint32_t site, const long day) const;
+        time_t toUtc (const time_t local, const bool utc) const;
+        bool fireOnDay (const Compiled &c, const long localDay, time_t *fire) const;
+
+        const UtcOffsetTable *zone;
+        const ChebyshevEphemeris *ephemeris;
+        std::vector<Compiled> rules;
+        std::vector<SunSite>  sites;
+        std::map<std::pair<std::pair<double, double>, double>, uint32_t> siteLookup;
+        std::vector<SunArc>   arcs;          // day-major: arcs[(day - firstDay) * sites.size () + site]
+        long                  firstDay = 0;  // days since 1970 of the prepared range
+        long                  dayCount = 0;
+        size_t                preparedSites = 0;
+};
@@ -0,0 +1,84 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <functional>
+#include <queue>
+#include <utility>
+
+#include "simulation.hpp"
+
+SunSimulation::SunSimulation (const std::vector<SunSite> &siteList, const ChebyshevEphemeris *ephemeris)
+{
+    sites.reserve (siteList.size ());
+    for (const SunSite &s : siteList)
+    {
+        SunWait sw (s.latitude, s.longitude, s.twilightAngle);
+        sw.offsetHour = s.offsetHour;
+        sw.ephemeris = ephemeris;
+        sw.clock = &clock;
+        sw.utc = true;
+        sites.push_back (sw);
+    }
+}
+
+/*
+** Pending entries are (time, 2 * site + isRise)
+*/
+size_t SunSimulation::run (const time_t from, const time_t to, std::vector<SunSimulationEvent> *events)
+{
+    typedef std::pair<time_t, size_t> Pending;
+    std::priority_queue<Pending, std::vector<Pending>, std::greater<Pending>> pending;
+
+    clock.set ((double) from);
+    for (size_t i = 0; i < sites.size (); i++)
+    {
+        time_t next;
+        bool isRise;
+        if (sites[i].next_event (from - 1, &next, &isRise)) pending.push (std::make_pair (next, (i << 1) | isRise));
+    }
+
+    size_t fired = 0;
+    while (!pending.empty () && pending.top ().first < to)
+    {
+        time_t t = pending.top ().first;
+        size_t site = pending.top ().second >> 1;
+        bool isRise = pending.top ().second & 1;
+        pending.pop ();
+
+        // Event times are rounded down: the state has changed one second later
+        clock.set ((double) (t + 1));
+        if ((sites[site].poll () == EXIT_DAY) != isRise) mismatches++;
+
+        if (events != nullptr) events->push_back ({ site, t, isRise });
+        fired++;
+
+        time_t next;
+        if (sites[site].next_event (t, &next, &isRise)) pending.push (std::make_pair (next, (site << 1) | isRise));
+    }
+    return fired;
+}
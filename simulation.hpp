@@ -0,0 +1,90 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <time.h>
+#include <vector>
+
+#include "libsunwait.hpp"
+#include "sunclock.hpp"
+
+class ChebyshevEphemeris;
+
+/**
+ * @brief An event fired by SunSimulation
+ */
+struct SunSimulationEvent
+{
+    /// Index of the site
+    size_t site;
+    /// Time of the event, rounded down to the second (as list() and next_event())
+    time_t time;
+    /// true for a sun rise, false for a sun set
+    bool   isRise;
+};
+
+/**
+ * @brief Runs the day/night schedules of many sites on a virtual clock
+ *
+ * The clock jumps from one event to the next, in time order over all sites, so years of schedules take seconds.
+ * The sites poll() the virtual clock after each of their events, which checks that the state has actually changed.
+ */
+class SunSimulation
+{
+    public:
+
+    /**
+     * @brief Construct a new SunSimulation object
+     *
+     * @param sites Sites with twilight angle and offset
+     * @param ephemeris Optional precomputed ephemeris (not owned, see SunWait::ephemeris)
+     */
+        SunSimulation (const std::vector<SunSite> &sites, const ChebyshevEphemeris *ephemeris = nullptr);
+
+    /**
+     * @brief Fire all events in [from, to)
+     *
+     * @param from Start of the simulation
+     * @param to End of the simulation
+     * @param events Events in time order (optional; appended to)
+     * @return Number of events fired
+     */
+        size_t run (const time_t from, const time_t to, std::vector<SunSimulationEvent> *events = nullptr);
+
+    /// The virtual clock of the sites: the time of the last event after run()
+        VirtualClock clock;
+
+    /// Events after which poll() did not report the new state
+        size_t       mismatches = 0;
+
+    private:
+
+        std::vector<SunWait> sites;
+};
@@ -52,6 +52,7 @@
 
 #include "sunarc.hpp"
 #include "sun.hpp"
+#include "ephemeris.hpp"
 #include "libsunwait.hpp"
 
 using namespace std;
@@ -92,47 +93,132 @@ using namespace std;
 /*                                                                      */
 /************************************************************************/
 // Reduce angle to within 0..359.999 degrees
-inline double revolution (const double x)
+template <typename T>
+inline T revolution (const T x)
 {
-    double remainder = fmod (x, (double) 360.0);
-    return remainder < (double) 0.0 ? remainder + (double) 360.0 : remainder;
+    T remainder = fmod (x, (T) 360.0);
+    return remainder < (T) 0.0 ? remainder + (T) 360.0 : remainder;
 }
 
-SunArc Sun::riset (unsigned long daysSince2000)
+/* The trigonometric functions in degrees, evaluated in the precision of the kernel */
+template <typename T> inline T tsind (const T x)           { return sin (x * (T) DEGREE_TO_RADIAN); }
+template <typename T> inline T tcosd (const T x)           { return cos (x * (T) DEGREE_TO_RADIAN); }
+template <typename T> inline T tacosd (const T x)          { return (T) RADIAN_TO_DEGREE * acos (x); }
+template <typename T> inline T tatan2d (const T y, const T x) { return (T) RADIAN_TO_DEGREE * atan2 (y, x); }
+
+/* Sine of the altitude the sun has to cross, for each altitude mode */
+template <typename T>
+inline T altitudeSine (AltitudeRuntime, const T angle, const T sradius)
+{
+    /* Do correction for upper limb ('top' of sun) only, for "daylight" sunrise or set. Otherwise calculate for centre of sun */
+    if (angle == (T) (TWILIGHT_ANGLE_DAYLIGHT))
+        return tsind (angle - sradius);
+    else
+        return tsind (angle);
+}
+template <typename T>
+inline T altitudeSine (AltitudeUpperLimb, const T angle, const T sradius) { return tsind (angle - sradius); }
+template <typename T>
+inline T altitudeSine (AltitudeCentre, const T angle, const T)            { return tsind (angle); }
+template <typename T>
+inline T altitudeSine (AltitudeDaylight, const T, const T sradius)        { return tsind ((T) (TWILIGHT_ANGLE_DAYLIGHT) - sradius); }
+template <typename T>
+inline T altitudeSine (AltitudeCivil, const T, const T)                   { return (T) SIN_TWILIGHT_CIVIL; }
+template <typename T>
+inline T altitudeSine (AltitudeNautical, const T, const T)                { return (T) SIN_TWILIGHT_NAUTICAL; }
+template <typename T>
+inline T altitudeSine (AltitudeAstronomical, const T, const T)            { return (T) SIN_TWILIGHT_ASTRONOMICAL; }
+
+/*
+** Partial derivatives of the diurnal arc and the south hour, from the expressions of riset:
+**     cos H = (sin h - sin lat sin dec) / (cos lat cos dec),  arc = 2 H / 15
+**     dH/dlat = (sin dec - sin h sin lat) / (cos^2 lat cos dec sin H)
+**     dH/ddec = (sin lat - sin h sin dec) / (cos^2 dec cos lat sin H)
+**     dH/dh   = -cos h / (cos lat cos dec sin H)
+** and south = 12 - (GMST0 + 180 + lon - RA) / 15. For the day, the sun's ecliptic longitude L advances
+** with the true anomaly (Kepler's second law: dL/dd = n sqrt(1 - e^2) / r^2), and
+**     dRA/dL = cos(obl) / cos^2 dec,  ddec/dL = sin(obl) cos RA
+** The small drift of the sun's radius (upper limb) with the distance is neglected.
+*/
+template <typename T>
+static SunArcGradient arcGradient (const T latitude, const T sinAltitude, const T sra, const T sdec, const T sr,
+                                   const T d, const T diurnalArc)
+{
+    // Schlyter's rates for every backend (see SunArcGradient)
+    const double meanMotion = 0.9856002585;                  // degrees per day
+    const double gmstRate = 0.9856002585 + 4.70935E-5;       // GMST0, degrees per day
+    const double eccentricity = 0.016709 - 1.151E-9 * d;
+    const double obliquity = 23.4393 - 3.563E-7 * d;
+
+    double sinLat = sind (latitude), cosLat = cosd (latitude);
+    double sinDec = sind (sdec), cosDec = cosd (sdec);
+    double dLdd = meanMotion * sqrt (1.0 - eccentricity * eccentricity) / ((double) sr * (double) sr);
+    double dRAdd = dLdd * cosd (obliquity) / (cosDec * cosDec);
+    double dDecdd = dLdd * sind (obliquity) * cosd (sra);
+
+    SunArcGradient gradient;
+    gradient.southLongitude = -1.0 / 15.0;
+    gradient.southDay = -(gmstRate - dRAdd) / 15.0;
+
+    if (diurnalArc > (T) 0.0 && diurnalArc < (T) 24.0)
+    {
+        double cosH = (sinAltitude - sinLat * sinDec) / (cosLat * cosDec);
+        double sinH = sqrt (1.0 - cosH * cosH);
+        if (sinH > 1e-9)
+        {
+            double cosAltitude = sqrt (1.0 - (double) sinAltitude * sinAltitude);
+            gradient.arcLatitude = 2.0 / 15.0 * (sinDec - sinAltitude * sinLat) / (cosLat * cosLat * cosDec * sinH);
+            gradient.arcAngle = -2.0 / 15.0 * cosAltitude / (cosLat * cosDec * sinH);
+            gradient.arcDay = 2.0 / 15.0 * (sinLat - sinAltitude * sinDec) / (cosDec * cosDec * cosLat * sinH) * dDecdd;
+        }
+    }
+    return gradient;
+}
+
+template <typename T, typename AltitudeMode, typename Position>
+SunArc BasicSun<T, AltitudeMode, Position>::riset (unsigned long daysSince2000, SunArcGradient *gradient)
 {
-    double sr;               /* solar distance, astronomical units */
-    double sra;              /* sun's right ascension */
-    double sdec;             /* sun's declination */
-    double sradius;          /* sun's apparent radius */
-    double siderealTime;     /* local sidereal time */
-    double altitude;         /* sun's altitude: angle to the sun relative to the mathematical (flat-earth) horizon */
-    double diurnalArc = 0.0; /* the diurnal arc, hours */
-    double southHour  = 0.0; /* Hour UTC the sun is directly south (or north for southern Hemisphere) of lat/long position */
-
-    /* compute sideral time at 00:00 UTC of target day for this longitude. */
-    siderealTime = revolution (GMST0(daysSince2000) + 180.0 +
+    T sr;                    /* solar distance, astronomical units */
+    T sra;                   /* sun's right ascension */
+    T sdec;                  /* sun's declination */
+    T sradius;               /* sun's apparent radius */
+    T siderealTime;          /* local sidereal time */
+    T sinAltitude;           /* sine of the sun's altitude: angle to the sun relative to the mathematical (flat-earth) horizon */
+    T diurnalArc = 0.0;      /* the diurnal arc, hours */
+    T southHour  = 0.0;      /* Hour UTC the sun is directly south (or north for southern Hemisphere) of lat/long position */
+    long day = (long) daysSince2000;  /* days before 2000 arrive as their two's complement */
+    T d = (T) day + (T) 1.5;          /* noon UTC of the day: the formulas count from 2000 Jan 0.0 */
+
+    /* compute sideral time at 00:00 UTC of target day for this longitude (GMST0 is GMST - UT at d) */
+    siderealTime = revolution (GMST0(d) + (T) 180.0 +
                                longitude); // 180 = 0 hour UTC is measured 180 degrees from dateline
 
     /* compute sun's ra + decl at this moment */
-    sun_RA_dec (daysSince2000, &sra, &sdec, &sr );
+    if (ephemeris != nullptr && ephemeris->covers (d))
+    {
+        double dRA, dDec, dR;
+        ephemeris->sun_RA_dec (d, &dRA, &dDec, &dR );
+        sra = (T) dRA;
+        sdec = (T) dDec;
+        sr = (T) dR;
+    }
+    else
+        sun_RA_dec (d, &sra, &sdec, &sr );
 
     /* compute time when sun is directly south - in hours UTC. "12.00" == noon. "15" == 180degrees/12hours [degrees per hour] */
-    southHour = 12.0 - rev180 (siderealTime - sra) / 15.0;
+    southHour = (T) 12.0 - rev180 (siderealTime - sra) / (T) 15.0;
 
     /* compute the sun's apparent radius, degrees */
-    sradius = 0.2666 / sr;  // Apparent angular radius of sun is 0.2666/distance in AU (deg)
+    sradius = (T) 0.2666 / sr;  // Apparent angular radius of sun is 0.2666/distance in AU (deg)
 
-    /* Do correction for upper limb ('top' of sun) only, for "daylight" sunrise or set. Otherwise calculate for centre of sun */
-    if (twilightAngle == TWILIGHT_ANGLE_DAYLIGHT)
-        altitude = twilightAngle - sradius;
-    else
-        altitude = twilightAngle;
+    /* The altitude (upper limb or centre) is chosen by the altitude mode at compile time */
+    sinAltitude = altitudeSine (AltitudeMode(), twilightAngle, sradius);
 
     /* compute the diurnal arc that the sun traverses to reach the specified altitide altit: */
-    double cost = (sind(altitude) - sind(latitude) * sind(sdec)) / (cosd(latitude) * cosd(sdec));
+    T cost = (sinAltitude - tsind(latitude) * tsind(sdec)) / (tcosd(latitude) * tcosd(sdec));
 
-    if (abs(int(cost)) < 1.0)
-        diurnalArc = 2 * acosd(cost) / 15.0; /* Diurnal arc, hours */
+    if (cost > (T) -1.0 && cost < (T) 1.0)
+        diurnalArc = 2 * tacosd(cost) / (T) 15.0; /* Diurnal arc, hours */
     else if (cost >= 1.0)
         diurnalArc =  0.0; // Polar Night
     else
@@ -141,11 +227,14 @@ SunArc Sun::riset (unsigned long daysSince2000)
     if (debug)
     {
         printf ("Debug: sunriset.cpp: Sun directly south: %f UTC, Diurnal Arc = %f hours\n", southHour, diurnalArc);
-        printf ("Debug: sunriset.cpp: Days since 2000: %lu\n", daysSince2000);
+        printf ("Debug: sunriset.cpp: Days since 2000: %ld\n", day);
         if (diurnalArc >= 24.0) printf ("Debug: sunriset.cpp: No rise or set: Midnight Sun\n");
         if (diurnalArc <=  0.0) printf ("Debug: sunriset.cpp: No rise or set: Polar Night\n");
     }
 
+    /* The derivatives of the same expressions, when asked for */
+    if (gradient != nullptr) *gradient = arcGradient (latitude, sinAltitude, sra, sdec, sr, d, diurnalArc);
+
     // Error Check - just make sure odd things don't happen (causing trouble further on)
     if (diurnalArc > 24.0) diurnalArc = 24.0;
     if (diurnalArc <  0.0) diurnalArc =  0.0;
@@ -155,7 +244,8 @@ SunArc Sun::riset (unsigned long daysSince2000)
     return result;
 }
 
-void Sun::sunpos (const double d, double *lon, double *r)
+template <typename T>
+void PositionSchlyter::sunpos (const T d, T *lon, T *r)
 /******************************************************/
 /* Computes the Sun's ecliptic longitude and distance */
 /* at an instant given in d, number of days since     */
@@ -163,7 +253,7 @@ void Sun::sunpos (const double d, double *lon, double *r)
 /* computed, since it's always very near 0.           */
 /******************************************************/
 {
-    double M,         /* Mean anomaly of the Sun */
+    T      M,         /* Mean anomaly of the Sun */
            w,         /* Mean longitude of perihelion */
            /* Note: Sun's mean longitude = M + w */
            e,         /* Eccentricity of Earth's orbit */
@@ -172,60 +262,63 @@ void Sun::sunpos (const double d, double *lon, double *r)
            v;         /* True anomaly */
 
     /* Compute mean elements */
-    M = revolution (356.0470 + 0.9856002585 * d);
-    w = 282.9404 + 4.70935E-5 * d;
-    e = 0.016709 - 1.151E-9 * d;
+    M = revolution ((T) 356.0470 + (T) 0.9856002585 * d);
+    w = (T) 282.9404 + (T) 4.70935E-5 * d;
+    e = (T) 0.016709 - (T) 1.151E-9 * d;
 
     /* Compute true longitude and radius vector */
-    E = M + e * RADIAN_TO_DEGREE * sind(M) * (1.0 + e * cosd(M));
-    x = cosd (E) - e;
-    y = sqrt (1.0 - e * e) * sind(E);
+    E = M + e * (T) RADIAN_TO_DEGREE * tsind(M) * ((T) 1.0 + e * tcosd(M));
+    x = tcosd (E) - e;
+    y = sqrt ((T) 1.0 - e * e) * tsind(E);
     *r = sqrt (x * x + y * y);          /* Solar distance */
-    v = atan2d (y, x);                  /* True anomaly */
+    v = tatan2d (y, x);                 /* True anomaly */
     *lon = revolution (v + w);          /* True solar longitude, made 0..360 degrees */
 }
 
-void Sun::sun_RA_dec (const double d, double *RA, double *dec, double *r)
+template <typename T>
+void PositionSchlyter::sun_RA_dec (const T d, T *RA, T *dec, T *r)
 {
-    double lon, obl_ecl;
-    double xs, ys; //, zs;
-    double xe, ye, ze;
+    T lon, obl_ecl;
+    T xs, ys; //, zs;
+    T xe, ye, ze;
 
     /* Compute Sun's ecliptical coordinates */
     sunpos (d, &lon, r);
 
     /* Compute ecliptic rectangular coordinates */
-    xs = *r * cosd(lon);
-    ys = *r * sind(lon);
+    xs = *r * tcosd(lon);
+    ys = *r * tsind(lon);
     //zs = 0; /* because the Sun is always in the ecliptic plane! */
 
     /* Compute obliquity of ecliptic (inclination of Earth's axis) */
-    obl_ecl = 23.4393 - 3.563E-7 * d;
+    obl_ecl = (T) 23.4393 - (T) 3.563E-7 * d;
 
     /* Convert to equatorial rectangular coordinates - x is unchanged */
     xe = xs;
-    ye = ys * cosd(obl_ecl);
-    ze = ys * sind(obl_ecl);
+    ye = ys * tcosd(obl_ecl);
+    ze = ys * tsind(obl_ecl);
 
     /* Convert to spherical coordinates */
-    *RA = atan2d(ye, xe);
-    *dec = atan2d(ze, sqrt(xe * xe + ye * ye));
+    *RA = tatan2d(ye, xe);
+    *dec = tatan2d(ze, sqrt(xe * xe + ye * ye));
 }
 
 
 // Reduce angle to -179.999 to +180 degrees
-double Sun::rev180 (const double x)
+template <typename T, typename AltitudeMode, typename Position>
+T BasicSun<T, AltitudeMode, Position>::rev180 (const T x)
 {
-    double y = revolution (x);
-    return y <= (double) 180.0 ? y : y - (double) 360.0;
+    T y = revolution (x);
+    return y <= (T) 180.0 ? y : y - (T) 360.0;
 }
 
 
 // Time must be between 0:00 amd 23:59
-double Sun::fix24 (const double x)
+template <typename T, typename AltitudeMode, typename Position>
+T BasicSun<T, AltitudeMode, Position>::fix24 (const T x)
 {
-    double remainder = fmod (x, (double) 24.0);
-    return remainder < (double) 0.0 ? remainder + (double) 24.0 : remainder;
+    T remainder = fmod (x, (T) 24.0);
+    return remainder < (T) 0.0 ? remainder + (T) 24.0 : remainder;
 }
 
 /*******************************************************************/
@@ -254,16 +347,113 @@ double Sun::fix24 (const double x)
 /*                                                                 */
 /*******************************************************************/
 
-double Sun::GMST0 (const double d)
+template <typename T>
+T PositionSchlyter::GMST0 (const T d)
 {
     /* Sidtime at 0h UT = L (Sun's mean longitude) + 180.0 degr  */
     /* L = M + w, as defined in sunpos().  Since I'm too lazy to */
     /* add these numbers, I'll let the C compiler do it for me.  */
     /* Any decent C compiler will add the constants at compile   */
     /* time, imposing no runtime or code overhead.               */
-    return revolution ((180.0 + 356.0470 + 282.9404) + (0.9856002585 + 4.70935E-5) * d);
+    return revolution ((T) (180.0 + 356.0470 + 282.9404) + (T) (0.9856002585 + 4.70935E-5) * d);
 }
 
+/*******************************************************************/
+/* The NOAA solar calculator, after Jean Meeus, Astronomical       */
+/* Algorithms, chapter 25 (low accuracy, about 0.01 degrees), with */
+/* the same d as above: JD = 2451543.5 + d, and the time in Julian */
+/* centuries since J2000.0 is T = (d - 1.5) / 36525.               */
+/* The longitude is the apparent one (nutation and aberration).    */
+/*******************************************************************/
+
+template <typename T>
+void PositionNOAA::sunpos (const T d, T *lon, T *r)
+{
+    T t = (d - (T) 1.5) / (T) 36525.0;
+    T L0 = revolution ((T) 280.46646 + t * ((T) 36000.76983 + t * (T) 0.0003032));   /* Geometric mean longitude */
+    T M = (T) 357.52911 + t * ((T) 35999.05029 - t * (T) 0.0001537);                  /* Mean anomaly */
+    T e = (T) 0.016708634 - t * ((T) 0.000042037 + t * (T) 0.0000001267);            /* Eccentricity */
+
+    /* Equation of the centre, true longitude and anomaly */
+    T C = tsind(M) * ((T) 1.914602 - t * ((T) 0.004817 + t * (T) 0.000014))
+          + tsind((T) 2.0 * M) * ((T) 0.019993 - t * (T) 0.000101) + tsind((T) 3.0 * M) * (T) 0.000289;
+    T v = M + C;
+    *r = (T) 1.000001018 * ((T) 1.0 - e * e) / ((T) 1.0 + e * tcosd(v));
+
+    /* Apparent longitude: nutation and aberration, with the longitude of the moon's node */
+    T omega = (T) 125.04 - (T) 1934.136 * t;
+    *lon = revolution (L0 + C - (T) 0.00569 - (T) 0.00478 * tsind(omega));
+}
+
+template <typename T>
+void PositionNOAA::sun_RA_dec (const T d, T *RA, T *dec, T *r)
+{
+    T lon;
+    sunpos (d, &lon, r);
+
+    /* Mean obliquity (Meeus 22.2), corrected for nutation */
+    T t = (d - (T) 1.5) / (T) 36525.0;
+    T omega = (T) 125.04 - (T) 1934.136 * t;
+    T obliquity = (T) 23.0 + ((T) 26.0 + ((T) 21.448 - t * ((T) 46.815 + t * ((T) 0.00059 - t * (T) 0.001813))) / (T) 60.0) / (T) 60.0
+                  + (T) 0.00256 * tcosd(omega);
+
+    *RA = tatan2d(tcosd(obliquity) * tsind(lon), tcosd(lon));
+    *dec = (T) RADIAN_TO_DEGREE * asin (tsind(obliquity) * tsind(lon));
+}
+
+template <typename T>
+T PositionNOAA::GMST0 (const T d)
+{
+    /* Meeus 12.4, GMST = 280.46061837 + 360.98564736629 D + ..., D = d - 1.5 days since J2000.0.  */
+    /* Less 360 degrees per day of UT (see above) that leaves 100.46061837 + 0.98564736629 D + ... */
+    T t = (d - (T) 1.5) / (T) 36525.0;
+    return revolution ((T) 100.46061837 + (T) 0.98564736629 * (d - (T) 1.5)
+                       + t * t * ((T) 0.000387933 - t / (T) 38710000.0));
+}
+
+/* The backends and kernels built into the library */
+template void PositionSchlyter::sunpos<double> (const double, double *, double *);
+template void PositionSchlyter::sun_RA_dec<double> (const double, double *, double *, double *);
+template double PositionSchlyter::GMST0<double> (const double);
+template void PositionSchlyter::sunpos<float> (const float, float *, float *);
+template void PositionSchlyter::sun_RA_dec<float> (const float, float *, float *, float *);
+template float PositionSchlyter::GMST0<float> (const float);
+template void PositionNOAA::sunpos<double> (const double, double *, double *);
+template void PositionNOAA::sun_RA_dec<double> (const double, double *, double *, double *);
+template double PositionNOAA::GMST0<double> (const double);
+template void PositionNOAA::sunpos<float> (const float, float *, float *);
+template void PositionNOAA::sun_RA_dec<float> (const float, float *, float *, float *);
+template float PositionNOAA::GMST0<float> (const float);
+
+template class BasicSun<double, AltitudeRuntime>;
+template class BasicSun<double, AltitudeUpperLimb>;
+template class BasicSun<double, AltitudeCentre>;
+template class BasicSun<double, AltitudeDaylight>;
+template class BasicSun<double, AltitudeCivil>;
+template class BasicSun<double, AltitudeNautical>;
+template class BasicSun<double, AltitudeAstronomical>;
+template class BasicSun<float,  AltitudeRuntime>;
+template class BasicSun<float,  AltitudeUpperLimb>;
+template class BasicSun<float,  AltitudeCentre>;
+template class BasicSun<float,  AltitudeDaylight>;
+template class BasicSun<float,  AltitudeCivil>;
+template class BasicSun<float,  AltitudeNautical>;
+template class BasicSun<float,  AltitudeAstronomical>;
+template class BasicSun<double, AltitudeRuntime, PositionNOAA>;
+template class BasicSun<double, AltitudeUpperLimb, PositionNOAA>;
+template class BasicSun<double, AltitudeCentre, PositionNOAA>;
+template class BasicSun<double, AltitudeDaylight, PositionNOAA>;
+template class BasicSun<double, AltitudeCivil, PositionNOAA>;
+template class BasicSun<double, AltitudeNautical, PositionNOAA>;
+template class BasicSun<double, AltitudeAstronomical, PositionNOAA>;
+template class BasicSun<float,  AltitudeRuntime, PositionNOAA>;
+template class BasicSun<float,  AltitudeUpperLimb, PositionNOAA>;
+template class BasicSun<float,  AltitudeCentre, PositionNOAA>;
+template class BasicSun<float,  AltitudeDaylight, PositionNOAA>;
+template class BasicSun<float,  AltitudeCivil, PositionNOAA>;
+template class BasicSun<float,  AltitudeNautical, PositionNOAA>;
+template class BasicSun<float,  AltitudeAstronomical, PositionNOAA>;
+
 
 
 
@@ -30,6 +30,8 @@
 
 #include "sunarc.hpp"
 
+class ChebyshevEphemeris;
+
 /* Some conversion factors between radians and degrees */
 #define RADIAN_TO_DEGREE   ( 180.0 / PI )
 #define DEGREE_TO_RADIAN   ( PI / 180.0 )
@@ -47,21 +49,72 @@
 
 // TBD : SUN POSITION?
 
-class Sun
+/*
+** Altitude modes of BasicSun: how the twilight angle is turned into the altitude
+** the sun has to cross. The choice is made at compile time, so riset() does not
+** have to compare the angle on every call.
+*/
+struct AltitudeRuntime {};       // Upper limb for TWILIGHT_ANGLE_DAYLIGHT, centre otherwise (decided per call)
+struct AltitudeUpperLimb {};     // Upper limb for any twilightAngle
+struct AltitudeCentre {};        // Centre of the sun for any twilightAngle
+struct AltitudeDaylight {};      // Fixed: sun rise and set (upper limb), twilightAngle is ignored
+struct AltitudeCivil {};         // Fixed: civil twilight, twilightAngle is ignored
+struct AltitudeNautical {};      // Fixed: nautical twilight, twilightAngle is ignored
+struct AltitudeAstronomical {};  // Fixed: astronomical twilight, twilightAngle is ignored
+
+/* Sines of the standard twilight angles (centre of the sun), folded at compile time */
+constexpr double SIN_TWILIGHT_CIVIL        = -0.10452846326765347; // sin(-6 deg)
+constexpr double SIN_TWILIGHT_NAUTICAL     = -0.20791169081775934; // sin(-12 deg)
+constexpr double SIN_TWILIGHT_ASTRONOMICAL = -0.30901699437494742; // sin(-18 deg)
+
+/*
+** Solar position backends of BasicSun, chosen at compile time like the altitude modes. Each gives,
+** for d days since 2000 Jan 0.0: the sun's ecliptic longitude and distance (sunpos), its right
+** ascension (-180 to 180 degrees), declination and distance (sun_RA_dec) and GMST0 (see sun.cpp).
+** They are instantiated in sun.cpp for float and double.
+*/
+struct PositionSchlyter          // Paul Schlyter's low precision formulas, about one arc minute
+{
+    template <typename T> static void sunpos (const T d, T *lon, T *r);
+    template <typename T> static void sun_RA_dec (const T d, T *RA, T *dec, T *r);
+    template <typename T> static T GMST0 (const T d);
+};
+struct PositionNOAA              // NOAA solar calculator (Meeus, chapter 25): apparent position, about 0.01 degrees
+{
+    template <typename T> static void sunpos (const T d, T *lon, T *r);
+    template <typename T> static void sun_RA_dec (const T d, T *RA, T *dec, T *r);
+    template <typename T> static T GMST0 (const T d);
+};
+
+/*
+** The sun kernel, for the floating point type T (float or double), one of the
+** altitude modes and one of the position backends above. Single precision halves the memory traffic and doubles the
+** SIMD width; its results are good to a few seconds, which is enough for minute
+** level schedules. riset() takes the sun's position at noon UTC of the day for the whole day.
+** The member functions are instantiated in sun.cpp for float and double, all
+** altitude modes and both backends.
+*/
+template <typename T, typename AltitudeMode = AltitudeRuntime, typename Position = PositionSchlyter>
+class BasicSun
 {
     public:
-        Sun(double lon, double lat, double angle) : longitude{lon}, latitude{lat}, twilightAngle{angle} {};
-        SunArc riset (unsigned long daysSince2000);
-        double longitude;
-        double latitude;
+        BasicSun(T lon, T lat, T angle) : longitude{lon}, latitude{lat}, twilightAngle{angle} {};
+        SunArc riset (unsigned long daysSince2000, SunArcGradient *gradient = nullptr);
+        T longitude;
+        T latitude;
         bool debug = false;
-        double twilightAngle;
+        T twilightAngle;
+        const ChebyshevEphemeris *ephemeris = nullptr; // When set (and covering the day) it replaces sun_RA_dec
+
+        static void sunpos (const T d, T *lon, T *r)                { Position::sunpos (d, lon, r); }
+        static T GMST0 (const T d)                                   { return Position::GMST0 (d); }
+        static void sun_RA_dec (const T d, T *RA, T *dec, T *r)     { Position::sun_RA_dec (d, RA, dec, r); }
 
     private:
-        void sunpos (const double d, double *lon, double *r);
+        T rev180 (const T x);
+        T fix24 (const T x);
+};
 
-        double rev180 (const double x);
-        double fix24 (const double x);
-        double GMST0 (const double d);
-        void sun_RA_dec (double d, double *RA, double *dec, double *r);
-};
\ No newline at end of file
+typedef BasicSun<double> Sun;
+typedef BasicSun<float>  SunFloat;
+typedef BasicSun<double, AltitudeRuntime, PositionNOAA> SunNOAA;
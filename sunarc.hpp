@@ -37,6 +37,16 @@ typedef enum
     , ONOFF_OFF
 } OnOff;
 
+/*
+** Solar position formulas (see PositionSchlyter and PositionNOAA in sun.hpp), for the
+** places that choose them at run time: SunWait, SunCache and ChebyshevEphemeris.
+*/
+typedef enum
+{
+    SUN_POSITION_SCHLYTER
+    , SUN_POSITION_NOAA
+} SunPositionBackend;
+
 
 
 
@@ -50,3 +60,28 @@ struct SunArc
     double getOffsetRiseHourUTC (const double pOffsetHour);
     double getOffsetSetHourUTC (const double pOffsetHour);
 };
+
+/*
+** Partial derivatives of a SunArc, from BasicSun::riset. The diurnal arc depends on latitude, twilight
+** angle and day; the south hour on longitude and day. Rise and set follow as south -/+ arc / 2.
+** Units are hours per degree, or hours per day for the day. At polar day or night (and within a few
+** seconds of it, where they grow without bound) the arc derivatives are zero.
+** The rates of the sun's motion behind them (mean motion, eccentricity, obliquity, GMST0) are Schlyter's
+** whatever the backend: with PositionNOAA they differ from that backend's own by parts in 10^5, far below
+** what a first-order correction resolves.
+*/
+struct SunArcGradient
+{
+    double arcLatitude = 0.0;
+    double arcAngle = 0.0;
+    double arcDay = 0.0;
+    double southLongitude = 0.0;
+    double southDay = 0.0;
+
+    double riseLatitude () const { return -arcLatitude / 2.0; }
+    double setLatitude () const  { return arcLatitude / 2.0; }
+    double riseAngle () const    { return -arcAngle / 2.0; }
+    double setAngle () const     { return arcAngle / 2.0; }
+    double riseDay () const      { return southDay - arcDay / 2.0; }
+    double setDay () const       { return southDay + arcDay / 2.0; }
+};
@@ -0,0 +1,242 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <math.h>
+
+#include "suncache.hpp"
+#include "sun.hpp"
+#include "libsunwait.hpp"
+
+/*
+** Largest |dH/dlat| (hour angle of rise or set per degree of latitude) over the
+** year and the common altitudes, at latitude lat:
+**
+**     cos H = (sin h - sin lat sin dec) / (cos lat cos dec)
+**     dH/dlat = (sin dec - sin h sin lat) / (cos^2 lat cos dec sin H)
+**
+** sin H is kept away from zero: right at the polar circles the derivative is
+** unbounded (see the class documentation).
+*/
+static double hourAngleSensitivity (const double lat)
+{
+    static const double cAltitudes[] = { TWILIGHT_ANGLE_DAYLIGHT - 0.27, TWILIGHT_ANGLE_CIVIL,
+                                         TWILIGHT_ANGLE_NAUTICAL, TWILIGHT_ANGLE_ASTRONOMICAL, 0.0
+                                       };
+    double maxSensitivity = 1e-3;
+    for (double altitude : cAltitudes)
+    {
+        for (double dec = -23.44; dec <= 23.44; dec += 0.5)
+        {
+            double cosH = (sind(altitude) - sind(lat) * sind(dec)) / (cosd(lat) * cosd(dec));
+            if (cosH <= -1.0 || cosH >= 1.0) continue; // No rise or set
+            double sinH = sqrt (1.0 - cosH * cosH);
+            if (sinH < 0.05) sinH = 0.05;
+            double sensitivity = fabs ((sind(dec) - sind(altitude) * sind(lat)) / (cosd(lat) * cosd(lat) * cosd(dec) * sinH));
+            if (sensitivity > maxSensitivity) maxSensitivity = sensitivity;
+        }
+    }
+    return maxSensitivity;
+}
+
+/* The sun arc of a cell centre, with the solar position formulas of SunKernel */
+template <typename SunKernel>
+static SunArc risetOf (const double longitude, const double latitude, const double angle, const unsigned long daysSince2000,
+                       const ChebyshevEphemeris *ephemeris, SunArcGradient *gradient = nullptr)
+{
+    SunKernel sun(longitude, latitude, angle);
+    sun.ephemeris = ephemeris;
+    return sun.riset (daysSince2000, gradient);
+}
+
+SunCache::SunCache(const double maxErrorSeconds, const size_t capacity)
+    : hits{0}, misses{0}, evictions{0}
+{
+    // Half of the error for each coordinate. Using the cell centre, the position is off by
+    // at most half a step, and one degree of hour angle is 240 seconds.
+    lonStep = maxErrorSeconds / 240.0;
+    for (int band = 0; band < 180; band++)
+    {
+        double worstLat = fmin (fmax (fabs (band - 90.0), fabs (band - 89.0)), 89.9);
+        latSteps[band] = fmin (maxErrorSeconds / (240.0 * hourAngleSensitivity (worstLat)), 1.0);
+    }
+
+    shardCapacity = capacity / cShards > 0 ? capacity / cShards : 1;
+    for (Shard &shard : shards) shard.entries.reserve (shardCapacity);
+}
+
+double SunCache::latitudeStep (const double latitude) const
+{
+    int band = (int) floor (latitude + 90.0);
+    if (band < 0) band = 0;
+    if (band > 179) band = 179;
+    return latSteps[band];
+}
+
+size_t SunCache::KeyHash::operator() (const Key &key) const
+{
+    unsigned long long h = (unsigned long long) key.latCell * 0x9E3779B97F4A7C15ULL;
+    h ^= (unsigned long long) key.lonCell + 0x632BE59BD9B4E019ULL + (h << 6) + (h >> 2);
+    h ^= (unsigned long long) key.day     + 0x85EBCA77C2B2AE63ULL + (h << 6) + (h >> 2);
+    h ^= (unsigned long long) (long long) (key.angle * 3600.0) + (h << 6) + (h >> 2);   // Twilight angles are negative
+    h ^= h >> 31;
+    return (size_t) h;
+}
+
+SunCache::Key SunCache::cellOf (const double latitude, const double longitude, const double angle,
+                                const unsigned long daysSince2000, double *latCentre, double *lonCentre) const
+{
+    // Quantise the position: latitude in one-degree bands, each with its own step
+    double lat = fmin (fmax (latitude, -90.0), 89.9999999);
+    int    band = (int) floor (lat + 90.0);
+    double latBandStart = band - 90.0;
+    double latStep = latSteps[band];
+    long long latSub = (long long) floor ((lat - latBandStart) / latStep);
+
+    double lon = fmod (longitude, 360.0);
+    if (lon < 0.0) lon += 360.0;
+    long long lonCell = (long long) floor (lon / lonStep);
+
+    *latCentre = fmin (latBandStart + (latSub + 0.5) * latStep, latBandStart + 1.0);
+    *lonCentre = (lonCell + 0.5) * lonStep;
+
+    Key key;
+    key.latCell = ((long long) band << 32) + latSub;
+    key.lonCell = lonCell;
+    key.day     = (long long) daysSince2000;
+    key.angle   = angle;
+    return key;
+}
+
+double SunCache::cellError (const double latitude, const double longitude, const double angle,
+                            const unsigned long daysSince2000, const ChebyshevEphemeris *ephemeris,
+                            const SunPositionBackend position) const
+{
+    double latCentre, lonCentre;
+    cellOf (latitude, longitude, angle, daysSince2000, &latCentre, &lonCentre);
+
+    // First order: the derivatives at the cell centre times the distance to it
+    SunArcGradient gradient;
+    if (position == SUN_POSITION_NOAA) risetOf<SunNOAA> (lonCentre, latCentre, angle, daysSince2000, ephemeris, &gradient);
+    else risetOf<Sun> (lonCentre, latCentre, angle, daysSince2000, ephemeris, &gradient);
+
+    double lonOffset = fmod (longitude - lonCentre, 360.0);
+    if (lonOffset >  180.0) lonOffset -= 360.0;
+    if (lonOffset < -180.0) lonOffset += 360.0;
+    double latOffset = latitude - latCentre;
+    double south = gradient.southLongitude * lonOffset;
+    double rise = fabs (south + gradient.riseLatitude () * latOffset);
+    double set  = fabs (south + gradient.setLatitude () * latOffset);
+    return fmax (rise, set) * 3600.0;
+}
+
+SunArc SunCache::riset (const double latitude, const double longitude, const double angle,
+                        const unsigned long daysSince2000, const ChebyshevEphemeris *ephemeris,
+                        const SunPositionBackend position)
+{
+    double latCentre, lonCentre;
+    Key key = cellOf (latitude, longitude, angle, daysSince2000, &latCentre, &lonCentre);
+
+    size_t hash = KeyHash() (key);
+    Shard &shard = shards[hash % cShards];
+
+    {
+        std::lock_guard<std::mutex> lock (shard.mutex);
+        auto found = shard.index.find (key);
+        if (found != shard.index.end ())
+        {
+            Entry &entry = shard.entries[found->second];
+            entry.referenced = true;
+            hits++;
+            return entry.arc;
+        }
+    }
+
+    // Compute the arc of the cell centre, outside the lock
+    misses++;
+    SunArc arc = position == SUN_POSITION_NOAA ? risetOf<SunNOAA> (lonCentre, latCentre, angle, daysSince2000, ephemeris)
+                                               : risetOf<Sun> (lonCentre, latCentre, angle, daysSince2000, ephemeris);
+
+    std::lock_guard<std::mutex> lock (shard.mutex);
+    if (shard.index.find (key) != shard.index.end ()) return arc; // Another thread was quicker
+
+    size_t slot;
+    if (shard.entries.size () < shardCapacity)
+    {
+        slot = shard.entries.size ();
+        shard.entries.push_back (Entry());
+    }
+    else
+    {
+        // CLOCK: skip (and clear) recently used entries, evict the first one not used since the last pass
+        while (shard.entries[shard.hand].referenced)
+        {
+            shard.entries[shard.hand].referenced = false;
+            shard.hand = (shard.hand + 1) % shardCapacity;
+        }
+        slot = shard.hand;
+        shard.hand = (shard.hand + 1) % shardCapacity;
+        shard.index.erase (shard.entries[slot].key);
+        evictions++;
+    }
+
+    Entry &entry = shard.entries[slot];
+    entry.key = key;
+    entry.arc = arc;
+    entry.referenced = false;
+    shard.index[key] = slot;
+    return arc;
+}
+
+SunCacheStats SunCache::stats () const
+{
+    SunCacheStats result;
+    result.hits      = hits;
+    result.misses    = misses;
+    result.evictions = evictions;
+    result.entries   = 0;
+    for (const Shard &shard : shards)
+    {
+        std::lock_guard<std::mutex> lock (shard.mutex);
+        result.entries += shard.index.size ();
+    }
+    return result;
+}
+
+void SunCache::clear ()
+{
+    for (Shard &shard : shards)
+    {
+        std::lock_guard<std::mutex> lock (shard.mutex);
+        shard.index.clear ();
+        shard.entries.clear ();
+        shard.hand = 0;
+    }
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
@@ -0,0 +1,170 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "sunarc.hpp"
+
+class ChebyshevEphemeris;
+
+/**
+ * @brief Counters of a SunCache
+ */
+struct SunCacheStats
+{
+    /// Lookups answered from the cache
+    unsigned long hits;
+    /// Lookups which had to compute the arc
+    unsigned long misses;
+    /// Entries dropped to make room
+    unsigned long evictions;
+    /// Entries currently held
+    size_t        entries;
+
+    /// Fraction of lookups answered from the cache
+    double hitRate () const
+    {
+        return hits + misses > 0 ? (double) hits / (double) (hits + misses) : 0.0;
+    }
+};
+
+/**
+ * @brief Cache of sun arcs shared by nearby sites
+ *
+ * Coordinates are quantised to a grid fine enough that using the arc of the cell centre instead of the exact
+ * position moves the rise and set times by at most the requested error. The longitude step follows from
+ * the 4 minutes per degree of the Earth's rotation; the latitude step is computed per one-degree band from the
+ * sensitivity of the hour angle to latitude, so it gets finer towards the poles. Close to the polar circles,
+ * where the sun barely reaches the altitude, the bound can't be guaranteed for the last minutes of days which
+ * are about to turn into polar days or nights.
+ *
+ * The cache holds at most a fixed number of entries and evicts with the CLOCK algorithm (an approximation of
+ * least recently used). It is split into independently locked shards and can be used from any number of threads.
+ * Set SunWait::cache to put it in front of all operations of a SunWait object.
+ */
+class SunCache
+{
+    public:
+    /**
+     * @brief Construct an empty cache
+     *
+     * @param maxErrorSeconds Largest change of the rise and set times caused by the quantisation
+     * @param capacity Maximum number of entries
+     */
+        SunCache(const double maxErrorSeconds = 1.0, const size_t capacity = 1 << 20);
+
+    /**
+     * @brief The sun arc of the cell containing the given position (see Sun::riset)
+     *
+     * @param latitude Geographical latitude in decimal degrees
+     * @param longitude Geographical longitude in decimal degrees
+     * @param angle Twilight angle in degrees
+     * @param daysSince2000 Day of the request
+     * @param ephemeris Optional precomputed ephemeris used when the arc is computed. A cache should always be used with the same setting.
+     * @param position Solar position formulas used when the arc is computed (and no ephemeris covers the day). The same applies.
+     */
+        SunArc riset (const double latitude, const double longitude, const double angle,
+                      const unsigned long daysSince2000, const ChebyshevEphemeris *ephemeris = nullptr,
+                      const SunPositionBackend position = SUN_POSITION_SCHLYTER);
+
+    /**
+     * @brief First-order error of using the arc of the cell instead of the exact position, seconds
+     *
+     * Uses the analytic derivatives of Sun::riset at the cell centre (see SunArcGradient): the larger of the
+     * rise and set shifts over the distance from the centre. Zero at polar day or night.
+     * The parameters are the same as for riset().
+     */
+        double cellError (const double latitude, const double longitude, const double angle,
+                          const unsigned long daysSince2000, const ChebyshevEphemeris *ephemeris = nullptr,
+                          const SunPositionBackend position = SUN_POSITION_SCHLYTER) const;
+
+    /**
+     * @brief Current counters
+     */
+        SunCacheStats stats () const;
+
+    /**
+     * @brief Drop all entries and reset the counters
+     */
+        void clear ();
+
+    /// Grid step in longitude, degrees
+        double longitudeStep () const { return lonStep; }
+
+    /// Grid step in latitude for the given latitude, degrees
+        double latitudeStep (const double latitude) const;
+
+    private:
+        struct Key
+        {
+            long long latCell;
+            long long lonCell;
+            long long day;
+            double angle;
+            bool operator== (const Key &other) const
+            {
+                return latCell == other.latCell && lonCell == other.lonCell && day == other.day && angle == other.angle;
+            }
+        };
+        struct KeyHash
+        {
+            size_t operator() (const Key &key) const;
+        };
+        struct Entry
+        {
+            Key    key;
+            SunArc arc;
+            bool   referenced;
+            Entry() : key(), arc(0.0, 0.0), referenced{false} {};
+        };
+        struct Shard
+        {
+            mutable std::mutex mutex;
+            std::unordered_map<Key, size_t, KeyHash> index;
+            std::vector<Entry> entries;
+            size_t hand = 0;
+        };
+
+        static const int cShards = 16;
+
+        Key cellOf (const double latitude, const double longitude, const double angle,
+                    const unsigned long daysSince2000, double *latCentre, double *lonCentre) const;
+
+        double lonStep;
+        double latSteps[180];   // per one-degree latitude band, from -90
+        size_t shardCapacity;
+        Shard  shards[cShards];
+        std::atomic<unsigned long> hits;
+        std::atomic<unsigned long> misses;
+        std::atomic<unsigned long> evictions;
+};
@@ -0,0 +1,93 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <math.h>
+#include <chrono>
+#include <thread>
+
+#if defined __linux__ || defined __APPLE__
+#include <errno.h>
+#include <time.h>
+#endif
+
+#include "sunclock.hpp"
+
+double SystemClock::now ()
+{
+#if defined __linux__ || defined __APPLE__
+    struct timespec now;
+    clock_gettime (CLOCK_REALTIME, &now);
+    return (double) now.tv_sec + now.tv_nsec * 1e-9;
+#else
+    return std::chrono::duration<double> (std::chrono::system_clock::now ().time_since_epoch ()).count ();
+#endif
+}
+
+/*
+** CLOCK_BOOTTIME includes time suspended and is never stepped; elsewhere the steady clock is the closest
+*/
+double SystemClock::elapsed ()
+{
+#if defined __linux__ && defined CLOCK_BOOTTIME
+    struct timespec now;
+    clock_gettime (CLOCK_BOOTTIME, &now);
+    return (double) now.tv_sec + now.tv_nsec * 1e-9;
+#else
+    return std::chrono::duration<double> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+#endif
+}
+
+void SystemClock::sleep (const double seconds)
+{
+    if (seconds <= 0.0) return;
+#if defined __linux__ && defined CLOCK_BOOTTIME
+    struct timespec request, remaining;
+    request.tv_sec = (time_t) seconds;
+    request.tv_nsec = (long) ((seconds - (double) request.tv_sec) * 1e9);
+    while (clock_nanosleep (CLOCK_BOOTTIME, 0, &request, &remaining) == EINTR) request = remaining;
+#else
+    std::this_thread::sleep_for (std::chrono::duration<double> (seconds));
+#endif
+}
+
+/*
+** An absolute sleep on CLOCK_REALTIME ends at the deadline even when the clock is stepped meanwhile
+*/
+void SystemClock::sleepUntil (const double deadline)
+{
+#if defined __linux__
+    struct timespec until;
+    until.tv_sec = (time_t) floor (deadline);
+    until.tv_nsec = (long) ((deadline - floor (deadline)) * 1e9);
+    while (clock_nanosleep (CLOCK_REALTIME, TIMER_ABSTIME, &until, nullptr) == EINTR) ;
+#else
+    std::this_thread::sleep_until (std::chrono::system_clock::time_point (
+                                       std::chrono::duration_cast<std::chrono::system_clock::duration> (
+                                           std::chrono::duration<double> (deadline))));
+#endif
+}
@@ -0,0 +1,123 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+/**
+ * @brief Source of the current time and of sleeps for SunWait
+ *
+ * By default SunWait uses the system clocks. Setting SunWait::clock to another implementation (e.g. VirtualClock)
+ * makes poll(), wait(), report() and the default target date run on its time instead.
+ */
+class SunClock
+{
+    public:
+
+        virtual ~SunClock () = default;
+
+    /**
+     * @brief Wall clock time
+     *
+     * @return Seconds since the epoch
+     */
+        virtual double now () = 0;
+
+    /**
+     * @brief Time on a clock which is never stepped, but counts time suspended
+     *
+     * @return Seconds since an arbitrary start
+     */
+        virtual double elapsed () = 0;
+
+    /**
+     * @brief Sleep for a duration of elapsed()
+     *
+     * @param seconds Duration
+     */
+        virtual void sleep (const double seconds) = 0;
+
+    /**
+     * @brief Sleep until the wall clock reaches a deadline
+     *
+     * @param deadline Seconds since the epoch
+     */
+        virtual void sleepUntil (const double deadline) = 0;
+};
+
+/**
+ * @brief The system clocks: CLOCK_REALTIME and CLOCK_BOOTTIME, where available
+ */
+class SystemClock : public SunClock
+{
+    public:
+        double now () override;
+        double elapsed () override;
+        void sleep (const double seconds) override;
+        void sleepUntil (const double deadline) override;
+};
+
+/**
+ * @brief A clock which only advances when it is slept on or set
+ *
+ * Sleeps return immediately after moving the time forward, so waits take no real time. Not thread safe.
+ */
+class VirtualClock : public SunClock
+{
+    public:
+
+    /**
+     * @brief Construct a new VirtualClock object
+     *
+     * @param start Initial wall clock time (seconds since the epoch)
+     */
+        explicit VirtualClock (const double start = 0.0) : current{start}, base{start} {};
+
+        double now () override { return current; }
+        double elapsed () override { return current - base; }
+        void sleep (const double seconds) override { if (seconds > 0.0) current += seconds; }
+        void sleepUntil (const double deadline) override { if (deadline > current) current = deadline; }
+
+    /**
+     * @brief Move the time to t, as if that much time had elapsed (also backwards)
+     *
+     * @param t Seconds since the epoch
+     */
+        void set (const double t) { current = t; }
+
+    /**
+     * @brief Step the wall clock only, as NTP or a user would
+     *
+     * @param seconds Step (negative to go back)
+     */
+        void step (const double seconds) { current += seconds; base += seconds; }
+
+    private:
+
+        double current;
+        double base;
+};
@@ -0,0 +1,218 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <new>
+
+#include "sunstate.hpp"
+
+static const time_t cHeartbeatSeconds = 60;     // longest sleep of run()
+static const time_t cRecheckSeconds   = 86400;  // sites without transitions are looked at again after this
+
+SunStatePublisher::SunStatePublisher(const std::vector<SunSite> &siteList, const ChebyshevEphemeris *precomputed)
+    : sites{siteList}, ephemeris{precomputed}
+{
+}
+
+SunStatePublisher::~SunStatePublisher()
+{
+    if (segment != nullptr)
+    {
+        munmap (segment, segmentSize);
+        shm_unlink (name.c_str ());
+    }
+}
+
+bool SunStatePublisher::create (const char *segmentName)
+{
+    if (segment != nullptr)
+    {
+        munmap (segment, segmentSize);
+        segment = nullptr;
+    }
+
+    // A segment of an earlier publisher is removed, not reused: its readers keep their mapping of the
+    // old object (which is never truncated under them) until they open the name again
+    shm_unlink (segmentName);
+    int fd = shm_open (segmentName, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0)
+    {
+        printf ("Error: Couldn't create the shared memory segment %s: %s\n", segmentName, strerror (errno));
+        return false;
+    }
+    segmentSize = sizeof (SunStateHeader) + sites.size () * sizeof (SunStateSlot);
+    if (ftruncate (fd, (off_t) segmentSize) < 0
+            || (segment = mmap (nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED)
+    {
+        printf ("Error: Couldn't map the shared memory segment %s: %s\n", segmentName, strerror (errno));
+        ::close (fd);
+        segment = nullptr;
+        return false;
+    }
+    ::close (fd);
+    name = segmentName;
+
+    // Readers check the magic number last, once everything else is in place
+    SunStateHeader *h = new (segment) SunStateHeader;
+    h->magic.store (0, std::memory_order_relaxed);
+    h->count = (uint32_t) sites.size ();
+    h->heartbeat.store (0, std::memory_order_relaxed);
+    for (size_t i = 0; i < sites.size (); i++)
+    {
+        SunStateSlot *slot = new (&slots ()[i]) SunStateSlot;
+        slot->sequence.store (0, std::memory_order_relaxed);
+    }
+
+    time_t now = time (nullptr);
+    pending = decltype (pending) ();
+    for (size_t i = 0; i < sites.size (); i++) pending.push (std::make_pair (publish (i, now), i << 1));
+    h->heartbeat.store (now, std::memory_order_relaxed);
+    h->magic.store (SUN_STATE_MAGIC, std::memory_order_release);
+    return true;
+}
+
+/*
+** Write the state of a site at now into its slot; returns the time of its next event
+*/
+time_t SunStatePublisher::publish (const size_t site, const time_t now)
+{
+    const SunSite &s = sites[site];
+    SunWait sw(s.latitude, s.longitude, s.twilightAngle);
+    sw.offsetHour = s.offsetHour;
+    sw.ephemeris = ephemeris;
+
+    unsigned char isDay;
+    sw.poll (&now, 1, &isDay);
+    time_t next;
+    bool found = sw.next_event (now, &next);
+
+    SunStateSlot &slot = slots ()[site];
+    uint32_t sequence = slot.sequence.load (std::memory_order_relaxed);
+    slot.sequence.store (sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+    slot.state.store (isDay ? EXIT_DAY : EXIT_NIGHT, std::memory_order_relaxed);
+    slot.since.store (now, std::memory_order_relaxed);
+    slot.next.store (found ? (int64_t) next : SUN_STATE_NO_TRANSITION, std::memory_order_relaxed);
+    slot.sequence.store (sequence + 2, std::memory_order_release);
+
+    return found ? next : now + cRecheckSeconds;
+}
+
+time_t SunStatePublisher::update (const time_t now)
+{
+    if (segment == nullptr) return now + cHeartbeatSeconds;
+
+    // Entries are (time, 2 * site + settle). Event times are rounded down to the second, so the state may
+    // only change within the second after: every update at an event is followed by a settling update.
+    while (!pending.empty () && pending.top ().first <= now)
+    {
+        size_t site = pending.top ().second >> 1;
+        bool settle = pending.top ().second & 1;
+        pending.pop ();
+        time_t next = publish (site, now);
+        if (settle) continue;
+        pending.push (std::make_pair (next, site << 1));
+        pending.push (std::make_pair (now + 1, (site << 1) | 1));
+    }
+    header ()->heartbeat.store (now, std::memory_order_release);
+    return pending.empty () ? now + cHeartbeatSeconds : pending.top ().first;
+}
+
+void SunStatePublisher::run ()
+{
+    std::unique_lock<std::mutex> lock (stopMutex);
+    while (!stopping)
+    {
+        time_t now = time (nullptr);
+        time_t next = std::min (update (now), now + cHeartbeatSeconds);
+        stopped.wait_until (lock, std::chrono::system_clock::from_time_t (next));
+    }
+}
+
+void SunStatePublisher::stop ()
+{
+    {
+        std::lock_guard<std::mutex> lock (stopMutex);
+        stopping = true;
+    }
+    stopped.notify_all ();
+}
+
+SunStateReader::~SunStateReader()
+{
+    close ();
+}
+
+bool SunStateReader::open (const char *segmentName)
+{
+    close ();
+    int fd = shm_open (segmentName, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        printf ("Error: Couldn't open the shared memory segment %s: %s\n", segmentName, strerror (errno));
+        return false;
+    }
+    struct stat status;
+    void *mapped = MAP_FAILED;
+    if (fstat (fd, &status) == 0 && (size_t) status.st_size >= sizeof (SunStateHeader))
+        mapped = mmap (nullptr, (size_t) status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close (fd);
+    if (mapped == MAP_FAILED)
+    {
+        printf ("Error: Couldn't map the shared memory segment %s\n", segmentName);
+        return false;
+    }
+
+    const SunStateHeader *h = (const SunStateHeader *) mapped;
+    if (h->magic.load (std::memory_order_acquire) != SUN_STATE_MAGIC
+            || sizeof (SunStateHeader) + (size_t) h->count * sizeof (SunStateSlot) > (size_t) status.st_size)
+    {
+        printf ("Error: %s is not a day/night state segment\n", segmentName);
+        munmap (mapped, (size_t) status.st_size);
+        return false;
+    }
+    header = h;
+    slots = (const SunStateSlot *) ((const char *) mapped + sizeof (SunStateHeader));
+    segmentSize = (size_t) status.st_size;
+    return true;
+}
+
+void SunStateReader::close ()
+{
+    if (header != nullptr) munmap ((void *) header, segmentSize);
+    header = nullptr;
+    slots = nullptr;
+    segmentSize = 0;
+}
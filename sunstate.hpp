@@ -0,0 +1,254 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "libsunwait.hpp"
+
+class ChebyshevEphemeris;
+
+/**
+ * @defgroup SunState Definitions for the shared day/night state
+ *
+ * @brief Defines of the shared memory segment written by SunStatePublisher
+ */
+/**
+ * @addtogroup SunState
+ * @{
+ */
+/// Default name of the shared memory segment
+#define SUN_STATE_NAME "/sunwait-state"
+/// Identifies a segment written by SunStatePublisher ("SUNS")
+#define SUN_STATE_MAGIC 0x53554E53u
+/// Next transition of a site without rise or set within a year
+#define SUN_STATE_NO_TRANSITION INT64_MAX
+/**@}*/
+
+static_assert (ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+               "the shared day/night state needs lock-free (address-free) atomics");
+
+/**
+ * @brief Header of the shared memory segment
+ */
+struct SunStateHeader
+{
+    /// SUN_STATE_MAGIC once the segment is initialised
+    std::atomic<uint32_t> magic;
+    /// Number of sites
+    uint32_t count;
+    /// Last time the publisher was awake (at least once a minute while it runs)
+    std::atomic<int64_t> heartbeat;
+};
+
+/**
+ * @brief State of one site in the shared memory segment, guarded by a sequence lock
+ *
+ * The sequence is odd while the publisher writes the slot.
+ */
+struct SunStateSlot
+{
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> state;
+    std::atomic<int64_t>  since;
+    std::atomic<int64_t>  next;
+};
+
+/**
+ * @brief Consistent copy of a SunStateSlot
+ */
+struct SunStateSnapshot
+{
+    /// EXIT_DAY or EXIT_NIGHT, as returned by SunWait::poll
+    int state;
+    /// Time the state was computed (the last transition, or the start of the publisher)
+    time_t since;
+    /// Time of the next rise or set, or SUN_STATE_NO_TRANSITION
+    time_t next;
+};
+
+/**
+ * @brief Publishes the day/night state of a set of sites in shared memory
+ *
+ * The segment holds a SunStateHeader followed by one SunStateSlot per site, in the order of the sites.
+ * Each slot is only written when its site has a transition (sun rise or set with its twilight angle and offset),
+ * so readers (SunStateReader) almost never have to retry.
+ */
+class SunStatePublisher
+{
+    public:
+    /**
+     * @brief Construct a publisher
+     *
+     * @param sites Sites to publish
+     * @param ephemeris Optional precomputed ephemeris, see SunWait::ephemeris. It is not owned by the publisher.
+     */
+        SunStatePublisher(const std::vector<SunSite> &sites, const ChebyshevEphemeris *ephemeris = nullptr);
+
+    /**
+     * @brief Unmap and remove the segment
+     */
+        ~SunStatePublisher();
+
+    /**
+     * @brief Create (or replace) the segment and publish the state of all sites at the current time
+     *
+     * An existing segment of the name is unlinked and a new one created. Readers which have the old one mapped keep
+     * it, with its heartbeat no longer advancing, until they open() again.
+     *
+     * @param name Name of the segment, see shm_open
+     * @return Return true when successful.
+     */
+        bool create (const char *name = SUN_STATE_NAME);
+
+    /**
+     * @brief Publish the transitions due at a time
+     *
+     * @param now Current time
+     * @return Time of the next update
+     */
+        time_t update (const time_t now);
+
+    /**
+     * @brief Update at each transition until stop() is called
+     */
+        void run ();
+
+    /**
+     * @brief Make run() return; may be called from any thread
+     */
+        void stop ();
+
+    private:
+        std::vector<SunSite> sites;
+        const ChebyshevEphemeris *ephemeris;
+        std::string name;
+        void *segment = nullptr;
+        size_t segmentSize = 0;
+        // (update time, 2 * site + settle) of the next transitions, earliest first
+        std::priority_queue<std::pair<time_t, size_t>, std::vector<std::pair<time_t, size_t>>,
+                            std::greater<std::pair<time_t, size_t>>> pending;
+        std::mutex stopMutex;
+        std::condition_variable stopped;
+        bool stopping = false;
+
+        SunStateHeader *header () const
+        {
+            return (SunStateHeader *) segment;
+        }
+        SunStateSlot *slots () const
+        {
+            return (SunStateSlot *) ((char *) segment + sizeof (SunStateHeader));
+        }
+        time_t publish (const size_t site, const time_t now);
+};
+
+/**
+ * @brief Reads the day/night state published by SunStatePublisher, without locks or system calls
+ */
+class SunStateReader
+{
+    public:
+        SunStateReader() = default;
+        ~SunStateReader();
+        SunStateReader(const SunStateReader &) = delete;
+        SunStateReader &operator= (const SunStateReader &) = delete;
+
+    /**
+     * @brief Map the segment (read-only)
+     *
+     * @param name Name of the segment, see shm_open
+     * @return Return true when successful.
+     */
+        bool open (const char *name = SUN_STATE_NAME);
+
+    /// Number of sites
+        size_t count () const
+        {
+            return header != nullptr ? header->count : 0;
+        }
+
+    /// Last time the publisher was awake
+        time_t heartbeat () const
+        {
+            return header != nullptr ? (time_t) header->heartbeat.load (std::memory_order_acquire) : 0;
+        }
+
+    /**
+     * @brief Consistent copy of the state of a site
+     *
+     * @param site Index of the site, in the order given to the publisher
+     * @param snapshot Output
+     * @return Return false when the site does not exist.
+     */
+        bool snapshot (const size_t site, SunStateSnapshot &snapshot) const
+        {
+            if (site >= count ()) return false;
+            const SunStateSlot &slot = slots[site];
+            for (;;)
+            {
+                uint32_t before = slot.sequence.load (std::memory_order_acquire);
+                if (before & 1u) continue;
+                snapshot.state = (int) slot.state.load (std::memory_order_relaxed);
+                snapshot.since = (time_t) slot.since.load (std::memory_order_relaxed);
+                snapshot.next  = (time_t) slot.next.load (std::memory_order_relaxed);
+                std::atomic_thread_fence (std::memory_order_acquire);
+                if (slot.sequence.load (std::memory_order_relaxed) == before) return true;
+            }
+        }
+
+    /**
+     * @brief Day or night at a site, as published
+     *
+     * @param site Index of the site, in the order given to the publisher
+     * @return Returns EXIT_DAY, EXIT_NIGHT or EXIT_ERROR (no such site)
+     */
+        int poll (const size_t site) const
+        {
+            SunStateSnapshot current;
+            return snapshot (site, current) ? current.state : EXIT_ERROR;
+        }
+
+    /// Unmap the segment
+        void close ();
+
+    private:
+        const SunStateHeader *header = nullptr;
+        const SunStateSlot *slots = nullptr;
+        size_t segmentSize = 0;
+};
@@ -0,0 +1,891 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+//
+// sunwait - command line tool built on libsunwait
+//
+// The classic verbs (poll, wait, list, report) work on one site given on the
+// command line, like the original sunwait executable. The batch verb streams
+// site records (CSV or NDJSON) and writes their rise and set times for a range
+// of days, using a pool of worker threads. Output order always follows input order.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "libsunwait.hpp"
+#include "coordinate.hpp"
+#include "ephemeris.hpp"
+#include "formatter.hpp"
+#if defined __linux__ || defined __APPLE__
+#include <signal.h>
+#include "sunstate.hpp"
+#endif
+#include "sun.hpp"
+
+static const size_t cChunkSites  = 2048;        // sites per work item
+static const size_t cOutputBuffer = 1 << 20;    // stdout buffer
+
+static void print_usage ()
+{
+    printf ("Usage: sunwait [options] poll|wait|list [days]|report [latitude longitude]\n"
+            "       sunwait batch [--input FILE] [--format csv|ndjson] [--times epoch|iso]\n"
+            "                     [--days N] [--from YYYY-MM-DD] [--threads N]\n"
+            "       sunwait publish [--input FILE] [--format csv|ndjson] [--name NAME]\n"
+            "       sunwait state [--name NAME] INDEX\n"
+            "\n"
+            "Options:\n"
+            "  daylight|civil|nautical|astronomical  Twilight type (default daylight)\n"
+            "  angle X                               Custom twilight angle in degrees\n"
+            "  offset [-]HH[:MM]                     Offset towards midday\n"
+            "  rise | set                            Wait for sun rise or set only\n"
+            "  utc                                   Print times in UTC\n"
+            "  y YY, m MM, d DD                      Target date for list and report\n"
+            "  debug                                 Print debug information\n"
+            "\n"
+            "Coordinates are given as e.g. 52.52N 13.41E.\n"
+            "Batch records: CSV \"id,latitude,longitude[,angle[,offset]]\" or NDJSON\n"
+            "{\"id\":...,\"lat\":...,\"lon\":...[,\"angle\":...][,\"offset\":...]}, with decimal coordinates\n"
+            "or degrees, minutes and seconds (52°31'12.5\"N). Output per site and day:\n"
+            "id, date, rise and set (seconds since the epoch or ISO 8601 UTC, empty/null for polar day\n"
+            "or night).\n"
+            "Publish keeps the day/night state of the sites (same records) in the shared memory segment\n"
+            "NAME (default /sunwait-state), updated at each rise and set; state prints the state of\n"
+            "the site with the given index (0 based, input order) and exits like poll.\n");
+}
+
+/*
+** Offset in hours from [-]HH[:MM]
+*/
+static bool parse_offset (const char *arg, double *offset)
+{
+    int sign = 1;
+    if (*arg == '-')
+    {
+        sign = -1;
+        arg++;
+    }
+    char *end;
+    long hh = strtol (arg, &end, 10);
+    long mm = 0;
+    if (end == arg) return false;
+    if (*end == ':')
+    {
+        const char *minutes = end + 1;
+        mm = strtol (minutes, &end, 10);
+        if (end == minutes || mm < 0 || mm > 59) return false;
+    }
+    if (*end != '\0') return false;
+    *offset = sign * (hh + mm / 60.0);
+    return true;
+}
+
+//
+// Batch mode
+//
+
+struct BatchRecord
+{
+    std::string id;
+    SunSite     site;
+};
+
+struct BatchChunk
+{
+    std::vector<BatchRecord> records;
+    std::string output;
+    bool done = false;
+};
+
+/*
+** Days since 1970-01-01 of a civil date (proleptic Gregorian)
+*/
+static long days_from_civil (long y, const unsigned m, const unsigned d)
+{
+    y -= m <= 2;
+    const long era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = (unsigned) (y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (long) doe - 719468;
+}
+
+/*
+** Latitude or longitude of a record: decimal or degrees, minutes and seconds
+*/
+static bool parse_axis (const char *text, const size_t length, const CoordinateAxis axis, double *value)
+{
+    CoordinateParse parsed = parseCoordinate (text, length);
+    if (!parsed.ok || (parsed.axis != COORDINATE_ANY && parsed.axis != axis)) return false;
+    *value = parsed.value;
+    return true;
+}
+
+/*
+** A number filling the text up to its end, or up to one of the characters of stop (nullptr: only the end)
+*/
+static bool parse_number (const char *text, const char *stop, double *value)
+{
+    char *end;
+    *value = strtod (text, &end);
+    if (end == text || !std::isfinite (*value)) return false;
+    while (*end == ' ' || *end == '\t') end++;
+    return *end == '\0' || (stop != nullptr && strchr (stop, *end) != nullptr);
+}
+
+/*
+** Four hex digits of a \u escape
+*/
+static bool parse_hex4 (const char *p, unsigned *code)
+{
+    *code = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        char c = p[i];
+        if (!isxdigit ((unsigned char) c)) return false;
+        *code = *code * 16 + (unsigned) (isdigit ((unsigned char) c) ? c - '0' : tolower ((unsigned char) c) - 'a' + 10);
+    }
+    return true;
+}
+
+/*
+** Decode the JSON string starting after the opening quote, up to the closing one
+*/
+static bool parse_json_string (const char *p, std::string &text)
+{
+    text.clear ();
+    for (; *p != '"'; p++)
+    {
+        if (*p == '\0') return false;
+        if (*p != '\\')
+        {
+            text.push_back (*p);
+            continue;
+        }
+        switch (*++p)
+        {
+            case '"': case '\\': case '/': text.push_back (*p); break;
+            case 'b': text.push_back ('\b'); break;
+            case 'f': text.push_back ('\f'); break;
+            case 'n': text.push_back ('\n'); break;
+            case 'r': text.push_back ('\r'); break;
+            case 't': text.push_back ('\t'); break;
+            case 'u':
+            {
+                // A code point as UTF-8; beyond the basic multilingual plane it comes as a surrogate pair
+                unsigned code, low;
+                if (!parse_hex4 (p + 1, &code)) return false;
+                p += 4;
+                if (code >= 0xDC00 && code <= 0xDFFF) return false;
+                if (code >= 0xD800 && code <= 0xDBFF)
+                {
+                    if (p[1] != '\\' || p[2] != 'u' || !parse_hex4 (p + 3, &low) || low < 0xDC00 || low > 0xDFFF) return false;
+                    p += 6;
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                }
+                if (code < 0x80) text.push_back ((char) code);
+                else if (code < 0x800)
+                {
+                    text.push_back ((char) (0xC0 | (code >> 6)));
+                    text.push_back ((char) (0x80 | (code & 0x3F)));
+                }
+                else if (code < 0x10000)
+                {
+                    text.push_back ((char) (0xE0 | (code >> 12)));
+                    text.push_back ((char) (0x80 | ((code >> 6) & 0x3F)));
+                    text.push_back ((char) (0x80 | (code & 0x3F)));
+                }
+                else
+                {
+                    text.push_back ((char) (0xF0 | (code >> 18)));
+                    text.push_back ((char) (0x80 | ((code >> 12) & 0x3F)));
+                    text.push_back ((char) (0x80 | ((code >> 6) & 0x3F)));
+                    text.push_back ((char) (0x80 | (code & 0x3F)));
+                }
+                break;
+            }
+            default: return false;
+        }
+    }
+    return true;
+}
+
+/*
+** A twilight angle as the angle option accepts it
+*/
+static bool parse_angle (const char *text, const char *stop, double *angle)
+{
+    return parse_number (text, stop, angle) && *angle > -90.0 && *angle < 90.0;
+}
+
+/*
+** Find "key": in an NDJSON line and return a pointer to the value (or nullptr)
+*/
+static const char *json_value (const char *line, const char *key)
+{
+    size_t keyLength = strlen (key);
+    for (const char *p = strchr (line, '"'); p != nullptr; p = strchr (p + 1, '"'))
+    {
+        if (strncmp (p + 1, key, keyLength) == 0 && p[keyLength + 1] == '"')
+        {
+            p += keyLength + 2;
+            while (*p == ' ' || *p == '\t') p++;
+            if (*p != ':') continue;
+            p++;
+            while (*p == ' ' || *p == '\t') p++;
+            return p;
+        }
+    }
+    return nullptr;
+}
+
+static bool parse_ndjson (const char *line, BatchRecord &record)
+{
+    const char *id  = json_value (line, "id");
+    const char *lat = json_value (line, "lat");
+    const char *lon = json_value (line, "lon");
+    if (id == nullptr || lat == nullptr || lon == nullptr) return false;
+
+    if (*id == '"')
+    {
+        if (!parse_json_string (id + 1, record.id)) return false;
+    }
+    else
+    {
+        const char *end = id + strcspn (id, ",} \t");
+        record.id.assign (id, end - id);
+    }
+
+    // Numbers, or strings holding e.g. degrees, minutes and seconds
+    const char *values[2] = { lat, lon };
+    double *targets[2] = { &record.site.latitude, &record.site.longitude };
+    for (int i = 0; i < 2; i++)
+    {
+        const char *start = values[i];
+        const char *end;
+        if (*start == '"')
+        {
+            start++;
+            end = strchr (start, '"');
+            if (end == nullptr) return false;
+        }
+        else
+            end = start + strcspn (start, ",} \t");
+        if (!parse_axis (start, end - start, i == 0 ? COORDINATE_LATITUDE : COORDINATE_LONGITUDE, targets[i]))
+            return false;
+    }
+
+    const char *angle = json_value (line, "angle");
+    record.site.twilightAngle = TWILIGHT_ANGLE_DAYLIGHT;
+    if (angle != nullptr && !parse_angle (angle, ",} \t", &record.site.twilightAngle)) return false;
+    const char *offset = json_value (line, "offset");
+    record.site.offsetHour = NO_OFFSET;
+    if (offset != nullptr && !parse_number (offset, ",} \t", &record.site.offsetHour)) return false;
+    return true;
+}
+
+/*
+** Split a CSV line into at most count fields in place (RFC 4180: quoted fields may hold commas and doubled quotes)
+*/
+static int split_csv (char *line, char **fields, const int count)
+{
+    int found = 0;
+    char *p = line;
+    while (found < count)
+    {
+        char *out = p;
+        fields[found++] = out;
+        if (*p == '"')
+        {
+            for (p++; ; p++)
+            {
+                if (*p == '\0') return -1;     // Unterminated quote
+                if (*p == '"')
+                {
+                    if (p[1] != '"') break;
+                    p++;
+                }
+                *out++ = *p;
+            }
+            p++;
+            if (*p != ',' && *p != '\0') return -1;
+        }
+        else
+        {
+            while (*p != ',' && *p != '\0') *out++ = *p++;
+        }
+        bool last = *p == '\0';
+        *out = '\0';
+        if (last) break;
+        p++;
+    }
+    return found;
+}
+
+static bool parse_csv (char *line, BatchRecord &record)
+{
+    char *fields[5] = { nullptr };
+    int count = split_csv (line, fields, 5);
+    if (count < 3) return false;
+
+    record.id = fields[0];
+    if (!parse_axis (fields[1], strlen (fields[1]), COORDINATE_LATITUDE, &record.site.latitude)) return false;
+    if (!parse_axis (fields[2], strlen (fields[2]), COORDINATE_LONGITUDE, &record.site.longitude)) return false;
+    record.site.twilightAngle = TWILIGHT_ANGLE_DAYLIGHT;
+    if (count > 3 && *fields[3] != '\0' && !parse_angle (fields[3], nullptr, &record.site.twilightAngle)) return false;
+    record.site.offsetHour = NO_OFFSET;
+    if (count > 4 && *fields[4] != '\0' && !parse_number (fields[4], nullptr, &record.site.offsetHour)) return false;
+    return true;
+}
+
+/*
+** An id as a JSON string, with quotes, backslashes and control characters escaped
+*/
+static void append_json_string (std::string &out, const std::string &text)
+{
+    out.push_back ('"');
+    for (char c : text)
+    {
+        switch (c)
+        {
+            case '"':  out.append ("\\\""); break;
+            case '\\': out.append ("\\\\"); break;
+            case '\n': out.append ("\\n"); break;
+            case '\r': out.append ("\\r"); break;
+            case '\t': out.append ("\\t"); break;
+            default:
+                if ((unsigned char) c < 0x20)
+                {
+                    char escaped[8];
+                    snprintf (escaped, sizeof (escaped), "\\u%04x", (unsigned) c);
+                    out.append (escaped);
+                }
+                else out.push_back (c);
+        }
+    }
+    out.push_back ('"');
+}
+
+/*
+** An id as a CSV field, quoted (RFC 4180) when it holds a comma, quote or line break
+*/
+static void append_csv_field (std::string &out, const std::string &text)
+{
+    if (text.find_first_of (",\"\r\n") == std::string::npos)
+    {
+        out.append (text);
+        return;
+    }
+    out.push_back ('"');
+    for (char c : text)
+    {
+        if (c == '"') out.push_back ('"');
+        out.push_back (c);
+    }
+    out.push_back ('"');
+}
+
+static void append_time (std::string &out, const time_t t, const TimeFormat format, const bool quoted)
+{
+    char buffer[FORMAT_TIME_MAX];
+    if (quoted) out.push_back ('"');
+    out.append (buffer, formatTime (buffer, t, format));
+    if (quoted) out.push_back ('"');
+}
+
+static void append_date (std::string &out, const long days1970)
+{
+    char buffer[FORMAT_TIME_MAX];
+    formatTime (buffer, (time_t) days1970 * 86400, TIME_FORMAT_ISO8601);
+    out.append (buffer, 10);    // YYYY-MM-DD
+}
+
+static void compute_chunk (BatchChunk &chunk, const long firstDay1970, const int days, const bool ndjson,
+                           const TimeFormat times, const ChebyshevEphemeris *ephemeris)
+{
+    const bool quoted = ndjson && times != TIME_FORMAT_EPOCH;
+    std::string &out = chunk.output;
+    out.reserve (chunk.records.size () * days * 48);
+
+    for (const BatchRecord &record : chunk.records)
+    {
+        Sun sun(record.site.longitude, record.site.latitude, record.site.twilightAngle);
+        sun.ephemeris = ephemeris;
+
+        for (int d = 0; d < days; d++)
+        {
+            long day1970 = firstDay1970 + d;
+            SunArc arc = sun.riset ((unsigned long) (day1970 - (DAYS_TO_2000)));
+            double offsetDiurnalArc = arc.diurnalArcWithOffset (record.site.offsetHour);
+            bool polar = offsetDiurnalArc <= 0.0 || offsetDiurnalArc >= 24.0;
+            double midnightUTC = (double) day1970 * 86400.0;
+
+            if (ndjson)
+            {
+                out.append ("{\"id\":");
+                append_json_string (out, record.id);
+                out.append (",\"date\":\"");
+                append_date (out, day1970);
+                out.append ("\",\"rise\":");
+            }
+            else
+            {
+                append_csv_field (out, record.id);
+                out.push_back (',');
+                append_date (out, day1970);
+                out.push_back (',');
+            }
+
+            // Rounded down to the second, as SunWait::list
+            if (polar)
+                out.append (ndjson ? "null" : "");
+            else
+                append_time (out, (time_t) floor (midnightUTC + arc.getOffsetRiseHourUTC (record.site.offsetHour) * 3600.0),
+                             times, quoted);
+
+            out.append (ndjson ? ",\"set\":" : ",");
+
+            if (polar)
+                out.append (ndjson ? "null" : "");
+            else
+                append_time (out, (time_t) floor (midnightUTC + arc.getOffsetSetHourUTC (record.site.offsetHour) * 3600.0),
+                             times, quoted);
+
+            out.append (ndjson ? "}\n" : "\n");
+        }
+    }
+}
+
+static int run_batch (int argc, char *argv[])
+{
+    const char *inputName = nullptr;
+    bool ndjson = false;
+    TimeFormat times = TIME_FORMAT_EPOCH;
+    int  days = 1;
+    int  threads = (int) std::thread::hardware_concurrency ();
+    time_t now = time (nullptr);
+    long firstDay1970 = (long) (now / 86400);
+
+    for (int i = 0; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (value == nullptr)
+        {
+            printf ("Error: Missing value for %s\n", arg);
+            return EXIT_ERROR;
+        }
+        i++;
+
+        if (!strcmp (arg, "--input")) inputName = value;
+        else if (!strcmp (arg, "--format"))
+        {
+            if (!strcmp (value, "ndjson")) ndjson = true;
+            else if (!strcmp (value, "csv")) ndjson = false;
+            else
+            {
+                printf ("Error: Unknown format %s\n", value);
+                return EXIT_ERROR;
+            }
+        }
+        else if (!strcmp (arg, "--times"))
+        {
+            if (!strcmp (value, "epoch")) times = TIME_FORMAT_EPOCH;
+            else if (!strcmp (value, "iso")) times = TIME_FORMAT_ISO8601;
+            else
+            {
+                printf ("Error: Unknown time format %s\n", value);
+                return EXIT_ERROR;
+            }
+        }
+        else if (!strcmp (arg, "--days")) days = atoi (value);
+        else if (!strcmp (arg, "--threads")) threads = atoi (value);
+        else if (!strcmp (arg, "--from"))
+        {
+            int y, m, d;
+            if (sscanf (value, "%d-%d-%d", &y, &m, &d) != 3 || m < 1 || m > 12 || d < 1 || d > 31)
+            {
+                printf ("Error: Couldn't parse the date %s\n", value);
+                return EXIT_ERROR;
+            }
+            firstDay1970 = days_from_civil (y, (unsigned) m, (unsigned) d);
+        }
+        else
+        {
+            printf ("Error: Unknown batch option %s\n", arg);
+            return EXIT_ERROR;
+        }
+    }
+    if (days < 1) days = 1;
+    if (threads < 1) threads = 1;
+
+    FILE *input = stdin;
+    if (inputName != nullptr && (input = fopen (inputName, "r")) == nullptr)
+    {
+        printf ("Error: Couldn't open %s\n", inputName);
+        return EXIT_ERROR;
+    }
+
+    static char outputBuffer[cOutputBuffer];
+    setvbuf (stdout, outputBuffer, _IOFBF, sizeof (outputBuffer));
+
+    ChebyshevEphemeris ephemeris;
+
+    // Chunks are handed to the workers in input order and written in the same order
+    std::vector<BatchChunk *> queue;
+    size_t nextToCompute = 0;
+    bool   inputDone = false;
+    std::mutex mutex;
+    std::condition_variable workAvailable, chunkDone, spaceAvailable;
+    const size_t maxQueued = 4 * (size_t) threads;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.push_back (std::thread([&] ()
+        {
+            for (;;)
+            {
+                BatchChunk *chunk;
+                {
+                    std::unique_lock<std::mutex> lock (mutex);
+                    workAvailable.wait (lock, [&] { return nextToCompute < queue.size () || inputDone; });
+                    if (nextToCompute >= queue.size ()) return;
+                    chunk = queue[nextToCompute++];
+                }
+                compute_chunk (*chunk, firstDay1970, days, ndjson, times, &ephemeris);
+                {
+                    std::lock_guard<std::mutex> lock (mutex);
+                    chunk->done = true;
+                }
+                chunkDone.notify_all ();
+            }
+        }));
+    }
+
+    // The writer runs alongside the reader and frees chunks once written
+    size_t written = 0;
+    std::thread writer ([&] ()
+    {
+        for (;;)
+        {
+            BatchChunk *chunk;
+            {
+                std::unique_lock<std::mutex> lock (mutex);
+                chunkDone.wait (lock, [&] { return (written < queue.size () && queue[written]->done)
+                                                 || (inputDone && written == queue.size ()); });
+                if (written == queue.size ()) return;
+                chunk = queue[written];
+            }
+            fwrite (chunk->output.data (), 1, chunk->output.size (), stdout);
+            {
+                std::lock_guard<std::mutex> lock (mutex);
+                delete chunk;
+                queue[written++] = nullptr;
+            }
+            spaceAvailable.notify_all ();
+        }
+    });
+
+    int  exitCode = EXIT_OK;
+    char *line = nullptr;
+    size_t lineCapacity = 0;
+    long lineNumber = 0;
+    BatchChunk *current = new BatchChunk();
+
+    auto submit = [&] (BatchChunk *chunk)
+    {
+        {
+            std::unique_lock<std::mutex> lock (mutex);
+            spaceAvailable.wait (lock, [&] { return queue.size () - written < maxQueued; });
+            queue.push_back (chunk);
+        }
+        workAvailable.notify_one ();
+    };
+
+    ssize_t length;
+    while ((length = getline (&line, &lineCapacity, input)) >= 0)
+    {
+        lineNumber++;
+        while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r')) line[--length] = '\0';
+        if (length == 0 || line[0] == '#') continue;
+
+        BatchRecord record;
+        bool ok = ndjson ? parse_ndjson (line, record) : parse_csv (line, record);
+        if (!ok)
+        {
+            // A CSV header line is fine
+            if (!ndjson && lineNumber == 1) continue;
+            printf ("Error: Couldn't parse line %ld\n", lineNumber);
+            exitCode = EXIT_ERROR;
+            continue;
+        }
+        current->records.push_back (record);
+        if (current->records.size () >= cChunkSites)
+        {
+            submit (current);
+            current = new BatchChunk();
+        }
+    }
+    if (!current->records.empty ()) submit (current);
+    else delete current;
+    free (line);
+
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        inputDone = true;
+    }
+    workAvailable.notify_all ();
+    chunkDone.notify_all ();
+    for (std::thread &worker : workers) worker.join ();
+    chunkDone.notify_all ();
+    writer.join ();
+    fflush (stdout);
+
+    if (input != stdin) fclose (input);
+    return exitCode;
+}
+
+#if defined __linux__ || defined __APPLE__
+
+//
+// Shared day/night state
+//
+
+static SunStatePublisher *gPublisher = nullptr;
+
+static void on_signal (int)
+{
+    if (gPublisher != nullptr) gPublisher->stop ();
+}
+
+static int run_publish (int argc, char *argv[])
+{
+    const char *inputName = nullptr;
+    const char *name = SUN_STATE_NAME;
+    bool ndjson = false;
+
+    for (int i = 0; i + 1 < argc; i += 2)
+    {
+        if (!strcmp (argv[i], "--input")) inputName = argv[i + 1];
+        else if (!strcmp (argv[i], "--name")) name = argv[i + 1];
+        else if (!strcmp (argv[i], "--format")) ndjson = !strcmp (argv[i + 1], "ndjson");
+        else
+        {
+            printf ("Error: Unknown publish option %s\n", argv[i]);
+            return EXIT_ERROR;
+        }
+    }
+
+    FILE *input = stdin;
+    if (inputName != nullptr && (input = fopen (inputName, "r")) == nullptr)
+    {
+        printf ("Error: Couldn't open %s\n", inputName);
+        return EXIT_ERROR;
+    }
+
+    std::vector<SunSite> sites;
+    char *line = nullptr;
+    size_t lineCapacity = 0;
+    ssize_t length;
+    long lineNumber = 0;
+    while ((length = getline (&line, &lineCapacity, input)) >= 0)
+    {
+        lineNumber++;
+        while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r')) line[--length] = '\0';
+        if (length == 0 || line[0] == '#') continue;
+
+        BatchRecord record;
+        if (ndjson ? parse_ndjson (line, record) : parse_csv (line, record)) sites.push_back (record.site);
+        else if (ndjson || lineNumber != 1)
+        {
+            printf ("Error: Couldn't parse line %ld\n", lineNumber);
+            free (line);
+            return EXIT_ERROR;
+        }
+    }
+    free (line);
+    if (input != stdin) fclose (input);
+
+    ChebyshevEphemeris ephemeris;
+    SunStatePublisher publisher (sites, &ephemeris);
+    if (!publisher.create (name)) return EXIT_ERROR;
+    gPublisher = &publisher;
+    signal (SIGINT, on_signal);
+    signal (SIGTERM, on_signal);
+    publisher.run ();
+    gPublisher = nullptr;
+    return EXIT_OK;
+}
+
+static int run_state (int argc, char *argv[])
+{
+    const char *name = SUN_STATE_NAME;
+    long site = -1;
+    for (int i = 0; i < argc; i++)
+    {
+        if (!strcmp (argv[i], "--name") && i + 1 < argc) name = argv[++i];
+        else site = atol (argv[i]);
+    }
+
+    SunStateReader reader;
+    if (!reader.open (name)) return EXIT_ERROR;
+    SunStateSnapshot snapshot;
+    if (site < 0 || !reader.snapshot ((size_t) site, snapshot))
+    {
+        printf ("Error: No site %ld (%zu sites)\n", site, reader.count ());
+        return EXIT_ERROR;
+    }
+    printf ("%s\n", snapshot.state == EXIT_DAY ? "DAY" : "NIGHT");
+    return snapshot.state;
+}
+
+#endif
+
+//
+// Classic verbs
+//
+
+int main (int argc, char *argv[])
+{
+    if (argc > 1 && !strcmp (argv[1], "batch")) return run_batch (argc - 2, argv + 2);
+#if defined __linux__ || defined __APPLE__
+    if (argc > 1 && !strcmp (argv[1], "publish")) return run_publish (argc - 2, argv + 2);
+    if (argc > 1 && !strcmp (argv[1], "state")) return run_state (argc - 2, argv + 2);
+#endif
+
+    SunWait sw;
+    const char *verb = nullptr;
+    const char *latitude = nullptr;
+    const char *longitude = nullptr;
+    int  listDays = 1;
+    int  year = NOT_SET, month = NOT_SET, day = NOT_SET;
+    bool reportSunrise = false, reportSunset = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if      (!strcmp (arg, "daylight"))     sw.twilightAngle = TWILIGHT_ANGLE_DAYLIGHT;
+        else if (!strcmp (arg, "civil"))        sw.twilightAngle = TWILIGHT_ANGLE_CIVIL;
+        else if (!strcmp (arg, "nautical"))     sw.twilightAngle = TWILIGHT_ANGLE_NAUTICAL;
+        else if (!strcmp (arg, "astronomical")) sw.twilightAngle = TWILIGHT_ANGLE_ASTRONOMICAL;
+        else if (!strcmp (arg, "utc") || !strcmp (arg, "gmt")) sw.utc = true;
+        else if (!strcmp (arg, "debug"))        sw.debug = true;
+        else if (!strcmp (arg, "rise"))         reportSunrise = true;
+        else if (!strcmp (arg, "set"))          reportSunset = true;
+        else if (!strcmp (arg, "angle") && value != nullptr)
+        {
+            sw.twilightAngle = atof (value);
+            if (sw.twilightAngle <= -90 || sw.twilightAngle >= 90)
+            {
+                printf ("Error: Twilight angle must be between -90 and +90 (-ve = below horizon), your setting: %f\n", sw.twilightAngle);
+                return EXIT_ERROR;
+            }
+            i++;
+        }
+        else if (!strcmp (arg, "offset") && value != nullptr)
+        {
+            if (!parse_offset (value, &sw.offsetHour))
+            {
+                printf ("Error: Couldn't parse the offset %s\n", value);
+                return EXIT_ERROR;
+            }
+            i++;
+        }
+        else if (!strcmp (arg, "y") && value != nullptr) year  = atoi (argv[++i]);
+        else if (!strcmp (arg, "m") && value != nullptr) month = atoi (argv[++i]);
+        else if (!strcmp (arg, "d") && value != nullptr) day   = atoi (argv[++i]);
+        else if (!strcmp (arg, "poll") || !strcmp (arg, "wait") || !strcmp (arg, "report")) verb = arg;
+        else if (!strcmp (arg, "list"))
+        {
+            verb = arg;
+            if (value != nullptr && atoi (value) > 0)
+            {
+                listDays = atoi (value);
+                i++;
+            }
+        }
+        else if (!strcmp (arg, "help") || !strcmp (arg, "-h") || !strcmp (arg, "--help"))
+        {
+            print_usage ();
+            return EXIT_OK;
+        }
+        else if (latitude == nullptr) latitude = arg;
+        else if (longitude == nullptr) longitude = arg;
+        else
+        {
+            printf ("Error: Unknown argument %s\n", arg);
+            print_usage ();
+            return EXIT_ERROR;
+        }
+    }
+
+    if (latitude != nullptr)
+    {
+        if (longitude == nullptr || !sw.setCoordinates (latitude, longitude))
+        {
+            printf ("\n");
+            return EXIT_ERROR;
+        }
+    }
+
+    if (verb == nullptr)
+    {
+        print_usage ();
+        return EXIT_ERROR;
+    }
+
+    if (!strcmp (verb, "poll"))
+    {
+        int exitCode = sw.poll ();
+        printf ("%s\n", exitCode == EXIT_DAY ? "DAY" : "NIGHT");
+        return exitCode;
+    }
+    if (!strcmp (verb, "wait"))
+    {
+        if (!reportSunrise && !reportSunset) reportSunrise = reportSunset = true;
+        return sw.wait (reportSunrise, reportSunset);
+    }
+    if (!strcmp (verb, "list"))
+    {
+        sw.print_list (listDays, year, month, day);
+        return EXIT_OK;
+    }
+    sw.generate_report (year, month, day);
+    return EXIT_OK;
+}
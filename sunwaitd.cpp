@@ -0,0 +1,277 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+//
+// sunwaitd - local query daemon built on libsunwait
+//
+// Serves poll, next-event and list queries from local processes over a Unix
+// domain socket (see daemon.hpp for the protocol). The load verb measures the
+// latency and throughput of a daemon, by default of one started in-process on
+// a temporary socket (loopback).
+//
+
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libsunwait.hpp"
+#include "daemon.hpp"
+
+typedef std::chrono::steady_clock Clock;
+
+static SunDaemon *gDaemon = nullptr;
+
+static void on_signal (int)
+{
+    if (gDaemon != nullptr) gDaemon->stop ();
+}
+
+static void print_usage ()
+{
+    printf ("Usage: sunwaitd [--socket PATH] [--cache SECONDS]\n"
+            "       sunwaitd load [--socket PATH] [--clients N] [--batch N] [--depth N] [--seconds S]\n"
+            "                     [--op poll|next|list]\n"
+            "\n"
+            "  --socket PATH    Socket of the daemon (default " SUNWAITD_SOCKET ").\n"
+            "                   Without it, load starts a daemon in-process on a temporary socket.\n"
+            "  --cache SECONDS  Error bound of the shared sun arc cache, 0 for exact results (default 1)\n"
+            "  --clients N      Concurrent connections (default 4)\n"
+            "  --batch N        Queries per frame (default 16)\n"
+            "  --depth N        Frames in flight per connection (default 4)\n"
+            "  --seconds S      Duration of the measurement (default 3)\n"
+            "  --op OP          Kind of query (default poll)\n");
+}
+
+struct LoadOptions
+{
+    const char *socketPath = nullptr;
+    double cacheSeconds = 1.0;
+    int clients = 4;
+    int batch = 16;
+    int depth = 4;
+    double seconds = 3.0;
+    uint8_t op = SUN_QUERY_POLL;
+};
+
+/*
+** One connection of the load generator: keep depth frames in flight and record
+** the time from sending each frame to receiving its answers
+*/
+static void load_client (const LoadOptions &options, const unsigned seed, std::vector<double> &latencies,
+                         uint64_t &queries, bool &failed)
+{
+    SunDaemonClient client;
+    if (!client.connect (options.socketPath))
+    {
+        failed = true;
+        return;
+    }
+
+    // Sites around the globe; a few hundred distinct ones, as a real user population would repeat
+    srand (seed);
+    std::vector<SunQuery> frame (options.batch);
+    std::vector<SunQuery> pool (512);
+    for (SunQuery &query : pool)
+    {
+        memset (&query, 0, sizeof (query));
+        query.op = options.op;
+        query.days = 7;
+        query.latitude = (rand () % 16000) / 100.0 - 80.0;
+        query.longitude = (rand () % 36000) / 100.0 - 180.0;
+        query.twilightAngle = TWILIGHT_ANGLE_DAYLIGHT;
+        query.time = 1704067200 + rand () % (365 * 86400);
+    }
+
+    std::deque<Clock::time_point> sent;
+    std::vector<SunAnswer> answers;
+    std::vector<SunListEntry> entries;
+    Clock::time_point end = Clock::now () + std::chrono::duration_cast<Clock::duration> (
+                                std::chrono::duration<double> (options.seconds));
+    uint32_t id = 0;
+    size_t next = 0;
+
+    for (;;)
+    {
+        bool running = Clock::now () < end;
+        while (running && (int) sent.size () < options.depth)
+        {
+            for (SunQuery &query : frame)
+            {
+                query = pool[next++ % pool.size ()];
+                query.id = id++;
+            }
+            if (!client.send (frame.data (), (uint32_t) frame.size ()))
+            {
+                failed = true;
+                return;
+            }
+            sent.push_back (Clock::now ());
+        }
+        if (sent.empty ()) break;
+
+        if (!client.receive (answers, entries) || answers.size () != frame.size ())
+        {
+            failed = true;
+            return;
+        }
+        latencies.push_back (std::chrono::duration<double> (Clock::now () - sent.front ()).count ());
+        sent.pop_front ();
+        queries += answers.size ();
+        for (const SunAnswer &answer : answers)
+            if (answer.status == SUN_STATUS_BAD_QUERY || answer.status == SUN_STATUS_LIMIT) failed = true;
+    }
+}
+
+static int run_load (const LoadOptions &options)
+{
+    LoadOptions actual = options;
+    std::string loopbackPath;
+    std::unique_ptr<SunDaemon> daemon;
+    std::thread server;
+
+    if (options.socketPath == nullptr)
+    {
+        loopbackPath = "/tmp/sunwaitd-load-" + std::to_string ((long) getpid ()) + ".sock";
+        actual.socketPath = loopbackPath.c_str ();
+        daemon.reset (new SunDaemon(options.cacheSeconds));
+        if (!daemon->listen (actual.socketPath)) return EXIT_ERROR;
+        server = std::thread (&SunDaemon::run, daemon.get ());
+    }
+
+    std::vector<std::vector<double>> latencies (options.clients);
+    std::vector<uint64_t> queries (options.clients, 0);
+    std::vector<char> failed (options.clients, 0);
+    std::vector<std::thread> clients;
+
+    Clock::time_point start = Clock::now ();
+    for (int c = 0; c < options.clients; c++)
+        clients.push_back (std::thread([&, c] ()
+        {
+            bool clientFailed = false;
+            load_client (actual, 1 + c, latencies[c], queries[c], clientFailed);
+            failed[c] = clientFailed;
+        }));
+    for (std::thread &client : clients) client.join ();
+    double seconds = std::chrono::duration<double> (Clock::now () - start).count ();
+
+    if (daemon)
+    {
+        daemon->stop ();
+        server.join ();
+    }
+
+    std::vector<double> all;
+    uint64_t total = 0;
+    bool anyFailed = false;
+    for (int c = 0; c < options.clients; c++)
+    {
+        all.insert (all.end (), latencies[c].begin (), latencies[c].end ());
+        total += queries[c];
+        anyFailed = anyFailed || failed[c];
+    }
+    if (anyFailed || all.empty ())
+    {
+        printf ("Error: The load test failed\n");
+        return EXIT_ERROR;
+    }
+    std::sort (all.begin (), all.end ());
+
+    printf ("%d clients, %d queries per frame, %d frames in flight, %s\n", options.clients, options.batch, options.depth,
+            options.socketPath == nullptr ? "loopback daemon" : options.socketPath);
+    printf ("%12.0f queries/s\n", total / seconds);
+    printf ("%12.1f us p50 frame latency\n", all[all.size () / 2] * 1e6);
+    printf ("%12.1f us p99 frame latency\n", all[all.size () * 99 / 100] * 1e6);
+    return EXIT_OK;
+}
+
+int main (int argc, char *argv[])
+{
+    LoadOptions options;
+    bool load = argc > 1 && !strcmp (argv[1], "load");
+
+    for (int i = load ? 2 : 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        if (!strcmp (arg, "help") || !strcmp (arg, "--help"))
+        {
+            print_usage ();
+            return EXIT_OK;
+        }
+        const char *value = i + 1 < argc ? argv[++i] : nullptr;
+        if (value == nullptr)
+        {
+            printf ("Error: Missing value for %s\n", arg);
+            return EXIT_ERROR;
+        }
+
+        if (!strcmp (arg, "--socket")) options.socketPath = value;
+        else if (!strcmp (arg, "--cache")) options.cacheSeconds = atof (value);
+        else if (load && !strcmp (arg, "--clients")) options.clients = std::max (1, atoi (value));
+        else if (load && !strcmp (arg, "--batch")) options.batch = std::min (std::max (1, atoi (value)), 16384);
+        else if (load && !strcmp (arg, "--depth")) options.depth = std::max (1, atoi (value));
+        else if (load && !strcmp (arg, "--seconds")) options.seconds = atof (value);
+        else if (load && !strcmp (arg, "--op"))
+        {
+            if (!strcmp (value, "poll")) options.op = SUN_QUERY_POLL;
+            else if (!strcmp (value, "next")) options.op = SUN_QUERY_NEXT;
+            else if (!strcmp (value, "list")) options.op = SUN_QUERY_LIST;
+            else
+            {
+                printf ("Error: Unknown query %s\n", value);
+                return EXIT_ERROR;
+            }
+        }
+        else
+        {
+            printf ("Error: Unknown option %s\n", arg);
+            print_usage ();
+            return EXIT_ERROR;
+        }
+    }
+
+    signal (SIGPIPE, SIG_IGN);
+    if (load) return run_load (options);
+
+    SunDaemon daemon (options.cacheSeconds);
+    if (!daemon.listen (options.socketPath != nullptr ? options.socketPath : SUNWAITD_SOCKET)) return EXIT_ERROR;
+    gDaemon = &daemon;
+    signal (SIGINT, on_signal);
+    signal (SIGTERM, on_signal);
+    daemon.run ();
+    gDaemon = nullptr;
+    return EXIT_OK;
+}
@@ -0,0 +1,121 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <math.h>
+
+#include "sweep.hpp"
+#include "sun.hpp"
+
+SunSweep::SunSweep(const std::vector<SunSite> &siteSet, const time_t t0, const time_t t1,
+                   const ChebyshevEphemeris *eph)
+    : sites{siteSet}, generators(siteSet.size ()), ephemeris{eph}, windowStart{t0}, windowEnd{t1}
+{
+    // Events of a UTC day can fall on the neighbouring days (large longitudes, offsets),
+    // so each generator starts one day early and the sweep ends one day late.
+    long firstDay = (long) (t0 >= 0 ? t0 / 86400 : (t0 - 86399) / 86400) - (DAYS_TO_2000) - 1;
+    lastDay = (long) (t1 >= 0 ? t1 / 86400 : (t1 - 86399) / 86400) - (DAYS_TO_2000) + 1;
+
+    for (size_t s = 0; s < sites.size (); s++)
+    {
+        loadDay (s, firstDay);
+        if (advance (s)) heap.push (HeapEntry (generators[s].times[generators[s].pending], s));
+    }
+}
+
+/*
+** Fill in the rise and set of the site for the given day. Polar days
+** and nights leave the generator exhausted for that day.
+*/
+void SunSweep::loadDay (const size_t site, const long day)
+{
+    const SunSite &s = sites[site];
+    Generator &g = generators[site];
+
+    Sun sun(s.longitude, s.latitude, s.twilightAngle);
+    sun.ephemeris = ephemeris;
+    SunArc arc = sun.riset ((unsigned long) day);
+
+    // riset() gives the south hour within 0-24 UTC, which flips by a whole day from one
+    // day to the next for longitudes near the date line. Keep it within 12 hours of the
+    // mean solar noon instead, so that each site's events stay in order without gaps.
+    double meanNoonUTC = 12.0 - (s.longitude > 180.0 ? s.longitude - 360.0 : s.longitude) / 15.0;
+    while (arc.southHourUTC - meanNoonUTC >  12.0) arc.southHourUTC -= 24.0;
+    while (arc.southHourUTC - meanNoonUTC < -12.0) arc.southHourUTC += 24.0;
+
+    g.day = day;
+    double offsetDiurnalArc = arc.diurnalArcWithOffset (s.offsetHour);
+    if (offsetDiurnalArc <= 0.0 || offsetDiurnalArc >= 24.0)
+    {
+        g.pending = 2;
+        return;
+    }
+
+    // Rounded down to the second, as SunWait::list
+    double midnightUTC = (double) ((time_t) (day + (DAYS_TO_2000)) * 86400);
+    g.times[0] = (time_t) floor (midnightUTC + arc.getOffsetRiseHourUTC (s.offsetHour) * 3600.0);
+    g.times[1] = (time_t) floor (midnightUTC + arc.getOffsetSetHourUTC  (s.offsetHour) * 3600.0);
+    g.pending = 0;
+}
+
+/*
+** Move the generator to its next event within the window.
+** Return false when the site has no more events.
+*/
+bool SunSweep::advance (const size_t site)
+{
+    Generator &g = generators[site];
+    for (;;)
+    {
+        while (g.pending < 2)
+        {
+            time_t t = g.times[g.pending];
+            if (t >= windowEnd) return false;
+            if (t >= windowStart) return true;
+            g.pending++;
+        }
+        if (g.day >= lastDay) return false;
+        loadDay (site, g.day + 1);
+    }
+}
+
+bool SunSweep::next (SunEvent &event)
+{
+    if (heap.empty ()) return false;
+
+    size_t site = heap.top ().second;
+    heap.pop ();
+
+    Generator &g = generators[site];
+    event.site = site;
+    event.kind = g.pending == 0 ? SUN_EVENT_RISE : SUN_EVENT_SET;
+    event.time = g.times[g.pending];
+
+    g.pending++;
+    if (advance (site)) heap.push (HeapEntry (g.times[g.pending], site));
+    return true;
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <time.h>
+#include <vector>
+#include <queue>
+#include <utility>
+#include <functional>
+
+#include "libsunwait.hpp"
+
+/**
+ * @brief Kind of a sun event
+ */
+typedef enum
+{
+    /// Sun rise (or the start of twilight / the offset rise)
+    SUN_EVENT_RISE
+    /// Sun set (or the end of twilight / the offset set)
+    , SUN_EVENT_SET
+} SunEventKind;
+
+/**
+ * @brief A sun event of one site
+ */
+struct SunEvent
+{
+    /// Index of the site in the site set
+    size_t       site;
+    /// Rise or set
+    SunEventKind kind;
+    /// Time of the event
+    time_t       time;
+};
+
+/**
+ * @brief Time-ordered stream of the sun events of many sites
+ *
+ * Produces every rise and set of every site between two times, in time order (events at the same time
+ * are ordered by site index). Each site is a lazy generator holding only its next event, and the
+ * generators are merged through a heap, so memory stays proportional to the number of sites and
+ * not to the number of events.
+ *
+ * Polar days and nights produce no events. The rise and set times are those returned by SunWait::list (in UTC), rounded
+ * down to the second alike, except for sites near the date line: where the south hour of Sun::riset wraps around
+ * midnight UTC, list skips or repeats an event, while the sweep keeps the south hour within 12 hours of mean solar noon
+ * and takes the event of the neighbouring day instead (see bench sweep).
+ */
+class SunSweep
+{
+    public:
+    /**
+     * @brief Prepare the sweep
+     *
+     * @param sites Site set (copied)
+     * @param t0 Start of the window (inclusive)
+     * @param t1 End of the window (exclusive)
+     * @param ephemeris Optional precomputed ephemeris, see SunWait::ephemeris
+     */
+        SunSweep(const std::vector<SunSite> &sites, const time_t t0, const time_t t1,
+                 const ChebyshevEphemeris *ephemeris = nullptr);
+
+    /**
+     * @brief Get the next event
+     *
+     * @param event Filled in with the next event
+     * @return Return false when there are no more events in the window.
+     */
+        bool next (SunEvent &event);
+
+    private:
+        struct Generator
+        {
+            long   day;       // days since 2000 of the events held
+            time_t times[2];  // rise and set of that day
+            int    pending;   // index of the next event held in times, 2 when exhausted
+        };
+        typedef std::pair<time_t, size_t> HeapEntry;
+
+        std::vector<SunSite>   sites;
+        std::vector<Generator> generators;
+        std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+        const ChebyshevEphemeris *ephemeris;
+        time_t windowStart;
+        time_t windowEnd;
+        long   lastDay;
+
+        bool advance (const size_t site);
+        void loadDay (const size_t site, const long day);
+};
@@ -0,0 +1,146 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <math.h>
+
+#include "track.hpp"
+#include "sun.hpp"
+#include "ephemeris.hpp"
+#include "root.hpp"
+
+static const double cMaxStepSeconds = 3600.0;   // longest interval between altitude checks
+static const double cTimeTolerance = 1e-3;      // seconds
+static const int    cMaxIterations = 60;
+
+/*
+** Sine of the sun's altitude minus that of the twilight angle: its sign is day (+) or night (-).
+*/
+double SunTrack::sinAltitude (const double t, const double latitude, const double longitude) const
+{
+    double dec, r, hourAngle;
+    sunAtInstant (ephemeris, t, &dec, &r, &hourAngle);
+    hourAngle += longitude;
+
+    // Upper limb for daylight, as Sun::riset
+    double target = angle == (TWILIGHT_ANGLE_DAYLIGHT) ? angle - 0.2666 / r : angle;
+    return sind (latitude) * sind (dec) + cosd (latitude) * cosd (dec) * cosd (hourAngle) - sind (target);
+}
+
+double SunTrack::altitude (const double t, const double latitude, const double longitude) const
+{
+    double s = sinAltitude (t, latitude, longitude) + sind (angle);
+    if (s > 1.0) s = 1.0;
+    if (s < -1.0) s = -1.0;
+    return asind (s) - angle;
+}
+
+/*
+** Linear motion from (lat0, lon0) by (dLat, dLon) over dt seconds
+*/
+struct TrackSegment
+{
+    double t0, dt, lat0, dLat, lon0, dLon;
+
+    void at (const double t, double *lat, double *lon) const
+    {
+        double f = dt > 0.0 ? (t - t0) / dt : 0.0;
+        *lat = lat0 + f * dLat;
+        *lon = lon0 + f * dLon;
+        if (*lon > 180.0) *lon -= 360.0;
+        if (*lon < -180.0) *lon += 360.0;
+    }
+};
+
+size_t SunTrack::events (const time_t *times, const double *latitudes, const double *longitudes, const size_t count,
+                         std::vector<SunTrackEvent> &events, unsigned char *isDay) const
+{
+    if (count == 0) return 0;
+
+    size_t found = 0;
+    double fPrevious = sinAltitude ((double) times[0], latitudes[0], longitudes[0]);
+    if (isDay != nullptr) isDay[0] = fPrevious >= 0.0;
+
+    for (size_t i = 0; i + 1 < count; i++)
+    {
+        TrackSegment segment;
+        segment.t0 = (double) times[i];
+        segment.dt = (double) (times[i + 1] - times[i]);
+        segment.lat0 = latitudes[i];
+        segment.dLat = latitudes[i + 1] - latitudes[i];
+        segment.lon0 = longitudes[i];
+        segment.dLon = longitudes[i + 1] - longitudes[i];
+        if (segment.dLon > 180.0) segment.dLon -= 360.0;
+        if (segment.dLon < -180.0) segment.dLon += 360.0;
+
+        double fEnd = sinAltitude ((double) times[i + 1], latitudes[i + 1], longitudes[i + 1]);
+        if (isDay != nullptr) isDay[i + 1] = fEnd >= 0.0;
+
+        // Long segments are checked in steps; short ones only at their end points
+        int steps = segment.dt > cMaxStepSeconds ? (int) ceil (segment.dt / cMaxStepSeconds) : 1;
+        double ta = segment.t0;
+        double fa = fPrevious;
+        for (int step = 1; step <= steps; step++)
+        {
+            double tb, fb;
+            if (step == steps)
+            {
+                tb = (double) times[i + 1];
+                fb = fEnd;
+            }
+            else
+            {
+                double lat, lon;
+                tb = segment.t0 + segment.dt * step / steps;
+                segment.at (tb, &lat, &lon);
+                fb = sinAltitude (tb, lat, lon);
+            }
+
+            if ((fa < 0.0) != (fb < 0.0))
+            {
+                auto along = [this, &segment] (const double t)
+                {
+                    double lat, lon;
+                    segment.at (t, &lat, &lon);
+                    return sinAltitude (t, lat, lon);
+                };
+                double t = illinoisRoot (along, ta, fa, tb, fb, cTimeTolerance, cMaxIterations);
+                SunTrackEvent event;
+                event.time = t;
+                event.point = i;
+                event.isRise = fb >= 0.0;
+                segment.at (t, &event.latitude, &event.longitude);
+                events.push_back (event);
+                found++;
+            }
+            ta = tb;
+            fa = fb;
+        }
+        fPrevious = fEnd;
+    }
+    return found;
+}
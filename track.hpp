@@ -0,0 +1,109 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <time.h>
+#include <vector>
+
+#include "libsunwait.hpp"
+
+class ChebyshevEphemeris;
+
+/**
+ * @brief A crossing of the twilight altitude along a track
+ */
+struct SunTrackEvent
+{
+    /// Time of the crossing, seconds since the epoch (with fraction)
+    double time;
+    /// Index of the track point before the crossing
+    size_t point;
+    /// true for a sun rise, false for a sun set
+    bool   isRise;
+    /// Interpolated position at the crossing, decimal degrees
+    double latitude;
+    /// Interpolated position at the crossing, decimal degrees
+    double longitude;
+};
+
+/**
+ * @brief Sun rise and set along the track of a moving observer
+ *
+ * The track is a series of time-stamped positions, between which the observer is assumed to move linearly (the
+ * shorter way around in longitude). The sun's altitude is evaluated once per point; where it crosses the
+ * twilight angle between two points, the instant is found by root finding on the interpolated track.
+ * Segments longer than an hour are checked at hourly steps, so a crossing and its return within one segment
+ * are found as well (except where the sun only grazes the altitude for less than that, close to polar day or night).
+ *
+ * Unlike Sun::riset, which takes one position of the sun for the whole day, the position is taken at the instant
+ * itself (within about 0.01 degrees of the NOAA formulas): for a fixed observer the times differ from those of
+ * SunWait by about a minute, and by several minutes at high latitudes (see bench regression).
+ */
+class SunTrack
+{
+    public:
+    /**
+     * @brief Construct a new SunTrack object
+     *
+     * @param twilightAngle Twilight angle in degrees, see SunWait::twilightAngle
+     * @param ephemeris Optional precomputed ephemeris, see SunWait::ephemeris
+     */
+        SunTrack (const double twilightAngle = TWILIGHT_ANGLE_DAYLIGHT, const ChebyshevEphemeris *ephemeris = nullptr)
+            : angle{twilightAngle}, ephemeris{ephemeris} {};
+
+    /**
+     * @brief Altitude of the sun above the twilight angle (degrees of the sun's centre; positive during the day)
+     *
+     * @param t Time, seconds since the epoch
+     * @param latitude Geographical latitude in decimal degrees
+     * @param longitude Geographical longitude in decimal degrees
+     */
+        double altitude (const double t, const double latitude, const double longitude) const;
+
+    /**
+     * @brief Find the sun rises and sets along a track, in one pass
+     *
+     * @param times Times of the points, ascending
+     * @param latitudes Latitudes of the points
+     * @param longitudes Longitudes of the points
+     * @param count Number of points
+     * @param events Crossings in time order (appended to)
+     * @param isDay Output array of count bytes: 1 where the sun is above the twilight angle, 0 below (optional)
+     * @return Number of crossings found
+     */
+        size_t events (const time_t *times, const double *latitudes, const double *longitudes, const size_t count,
+                       std::vector<SunTrackEvent> &events, unsigned char *isDay = nullptr) const;
+
+    private:
+        double sinAltitude (const double t, const double latitude, const double longitude) const;
+
+        double angle;
+        const ChebyshevEphemeris *ephemeris;
+};
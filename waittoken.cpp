@@ -0,0 +1,114 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#include <chrono>
+
+#include "libsunwait.hpp"
+#include "waittoken.hpp"
+#include "sunclock.hpp"
+
+static const double cRecheckSeconds = 1.0;   // longest wait on the steady clock, and so the delay after a resume
+
+void WaitToken::cancel ()
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        isCancelled = true;
+    }
+    condition.notify_all ();
+}
+
+void WaitToken::changed ()
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        changes++;
+    }
+    condition.notify_all ();
+}
+
+void WaitToken::reset ()
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    isCancelled = false;
+}
+
+bool WaitToken::cancelled ()
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    return isCancelled;
+}
+
+unsigned long WaitToken::generation ()
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    return changes;
+}
+
+/*
+** Called with the mutex held
+*/
+int WaitToken::state (const unsigned long startGeneration)
+{
+    if (isCancelled) return EXIT_CANCELLED;
+    if (changes != startGeneration) return EXIT_CHANGED;
+    return EXIT_OK;
+}
+
+/*
+** The deadline is on the clock's elapsed time, which counts time suspended, as in SunWait::sleepUntil. A condition
+** variable can't wait on that clock, only on the steady clock, which stops while suspended: the wait is split into
+** steps of at most cRecheckSeconds, after each of which the elapsed time is read again.
+*/
+int WaitToken::waitFor (const double seconds, const unsigned long startGeneration, SunClock &clock)
+{
+    std::unique_lock<std::mutex> lock (mutex);
+    const double deadline = clock.elapsed () + seconds;
+    while (state (startGeneration) == EXIT_OK)
+    {
+        double remaining = deadline - clock.elapsed ();
+        if (remaining <= 0.0) break;
+        condition.wait_for (lock, std::chrono::duration_cast<std::chrono::steady_clock::duration> (
+                                std::chrono::duration<double> (remaining < cRecheckSeconds ? remaining : cRecheckSeconds)));
+    }
+    return state (startGeneration);
+}
+
+/*
+** The condition variable waits on the system clock itself (pthread_cond_clockwait with CLOCK_REALTIME where
+** available), so the deadline is absolute as for clock_nanosleep.
+*/
+int WaitToken::waitUntil (const double deadline, const unsigned long startGeneration)
+{
+    std::unique_lock<std::mutex> lock (mutex);
+    std::chrono::system_clock::time_point until (
+        std::chrono::duration_cast<std::chrono::system_clock::duration> (std::chrono::duration<double> (deadline)));
+    while (state (startGeneration) == EXIT_OK)
+        if (condition.wait_until (lock, until) == std::cv_status::timeout) break;
+    return state (startGeneration);
+}
@@ -0,0 +1,110 @@
+/*******************************************************************************
+  Copyright(c) 2021 Joachim Janz. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of the GNU General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option)
+  any later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU Library General Public License
+  along with this library; see the file COPYING.LIB.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+
+  The full GNU General Public License is included in this distribution in the
+  file called LICENSE.
+
+  This library version is adapted from the sunwait executable licencsed under
+  the GPLv3 and written by Dan Risacher based on codes by Paul Schlyter and
+  with contributions of others mentioned in the original code which can be
+  found in https://github.com/risacher/sunwait
+  
+*******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+class SunClock;
+
+/**
+ * @brief Cancellation token for SunWait::wait
+ *
+ * Another thread interrupts a wait with cancel() (for shutdown) or changed() (after new coordinates, angle or offset
+ * were decided on). Waits block on a condition variable, so they return within microseconds. The token may be shared
+ * by any number of waits.
+ */
+class WaitToken
+{
+    public:
+
+    /**
+     * @brief Make all current and later waits return EXIT_CANCELLED, until reset()
+     */
+        void cancel ();
+
+    /**
+     * @brief Make the waits which are in progress return EXIT_CHANGED
+     *
+     * The waiting thread then applies the new settings to its SunWait object and waits again.
+     * The settings must not be changed while the wait runs.
+     */
+        void changed ();
+
+    /**
+     * @brief Clear a cancel()
+     */
+        void reset ();
+
+    /**
+     * @brief Check whether cancel() was called
+     *
+     * @return Return true when cancelled.
+     */
+        bool cancelled ();
+
+    /**
+     * @brief Number of changed() calls so far, which identifies the settings a wait started with
+     *
+     * @return The generation
+     */
+        unsigned long generation ();
+
+    /**
+     * @brief Block for a duration, or until cancel() or changed()
+     *
+     * The duration is measured on the clock's elapsed(), so time suspended counts; the wait ends within a second
+     * of a resume after the duration has passed.
+     *
+     * @param seconds Duration
+     * @param startGeneration generation() when the wait started
+     * @param clock Clock measuring the duration. It must advance by itself (SystemClock): a VirtualClock would
+     * never end the wait.
+     * @return Returns EXIT_OK when the time has passed, EXIT_CANCELLED or EXIT_CHANGED
+     */
+        int waitFor (const double seconds, const unsigned long startGeneration, SunClock &clock);
+
+    /**
+     * @brief Block until a wall clock time, or until cancel() or changed()
+     *
+     * @param deadline Seconds since the epoch
+     * @param startGeneration generation() when the wait started
+     * @return Returns EXIT_OK when the deadline has passed, EXIT_CANCELLED or EXIT_CHANGED
+     */
+        int waitUntil (const double deadline, const unsigned long startGeneration);
+
+    private:
+
+        int state (const unsigned long startGeneration);
+
+        std::mutex              mutex;
+        std::condition_variable condition;
+        bool                    isCancelled = false;
+        unsigned long           changes = 0;
+};